@@ -187,6 +187,27 @@
 
 #endif // (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
 
+/**
+ * @macro MYSTIC_ARCH_CPU_CACHE_LINE_SIZE
+ * @brief Size (in bytes) used to keep independently written data apart,
+ * avoiding false sharing. Can be overridden by the user.
+ */
+#if !defined(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE)
+# if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+/**
+ * @brief Set cache line size to 128 (some Arm64 cores use 128 byte lines).
+ */
+#  define MYSTIC_ARCH_CPU_CACHE_LINE_SIZE 128
+
+# else /* x86-64, x86, Arm32, and unknown */
+/**
+ * @brief Set cache line size to 64.
+ */
+#  define MYSTIC_ARCH_CPU_CACHE_LINE_SIZE 64
+
+# endif // (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+#endif // !defined(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE)
+
 /* =============================================
     CPU Runtime Logic
    --------------------------------------------- */
@@ -0,0 +1,511 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/async/cancellation.hpp
+ * @file cancellation.hpp
+ * @brief Defines cancellation tokens and deadlines.
+ *
+ * @details
+ * This header provides,
+ * 1. `cancellation_source`, which requests cancellation, and hands out
+ *    `cancellation_token`s, which observe it. A default constructed token
+ *    can never be cancelled, and costs nothing to check.
+ * 2. `cancellation_callback`, an RAII registration of a callable, run once
+ *    when cancellation is requested. The registration node lives inside the
+ *    callback object, so registering never allocates. Destroying it waits
+ *    for the callable, if it is running on another thread.
+ * 3. `deadline`, a point on the monotonic clock. Checking it is a single
+ *    compare against the clock (none for a deadline which never expires).
+ * 4. `check()`, which maps a token and a deadline to `StatusCode::CANCELLED`
+ *    or `StatusCode::DEADLINE_EXCEEDED`, so doomed work can be shed early.
+ *
+ * Blocking primitives in `mystic::concurrency` accept a token and a
+ * deadline, and return these codes when either fires.
+ *
+ * @code{.cpp}
+ * #include "mystic/async/cancellation.hpp"
+ *
+ * using mystic::status::StatusCode;
+ *
+ * StatusCode handle(Request& request, const mystic::async::cancellation_token& token) {
+ *     const auto until = mystic::async::deadline::after(std::chrono::milliseconds(50));
+ *     for (auto& step : request.steps) {
+ *         if (StatusCode code = mystic::async::check(token, until); code != StatusCode::OK) {
+ *             return code; // shed it, nobody waits for the answer anymore
+ *         }
+ *         step.run();
+ *     }
+ *     return StatusCode::OK;
+ * }
+ *
+ * mystic::async::cancellation_source source;
+ * handle(request, source.token());
+ * // ... on client disconnect
+ * source.request_cancellation();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/word_lock.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::async::internal {
+
+/**
+ * @brief Intrusive registration node of a cancellation callback.
+ */
+struct CancellationCallbackNode {
+    CancellationCallbackNode* previous = nullptr;
+    CancellationCallbackNode* next = nullptr;
+
+    /// Runs the callable, set by the owning cancellation_callback
+    void (*invoke)(CancellationCallbackNode*) noexcept = nullptr;
+
+    /// True while linked into the state's list
+    bool linked = false;
+
+    /// Set by the cancelling thread once invoke() returned
+    std::atomic<bool> completed{false};
+}; // struct CancellationCallbackNode
+
+/**
+ * @brief Shared state of a cancellation source and its tokens.
+ */
+class CancellationState {
+public:
+    CancellationState() noexcept = default;
+    CancellationState(const CancellationState&) = delete;
+    CancellationState& operator=(const CancellationState&) = delete;
+
+    void addRef() noexcept { references_.fetch_add(1, std::memory_order_relaxed); }
+
+    void release() noexcept {
+        if (references_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            delete this;
+        }
+    }
+
+    bool isCancelled() const noexcept { return cancelled_.load(std::memory_order_acquire); }
+
+    /**
+     * @brief Links node, fails if cancellation was already requested.
+     */
+    bool addCallback(CancellationCallbackNode* node) noexcept {
+        std::lock_guard<concurrency::word_lock> lock(lock_);
+        if (cancelled_.load(std::memory_order_relaxed)) {
+            return false;
+        }
+        node->next = head_;
+        node->previous = nullptr;
+        if (head_ != nullptr) {
+            head_->previous = node;
+        }
+        head_ = node;
+        node->linked = true;
+        return true;
+    }
+
+    /**
+     * @brief Unlinks node, or waits for it to finish running on another
+     * thread, so its owner can be destroyed afterwards.
+     */
+    void removeCallback(CancellationCallbackNode* node) noexcept {
+        {
+            std::lock_guard<concurrency::word_lock> lock(lock_);
+            if (node->linked) {
+                unlink(node);
+                return;
+            }
+            // Running on this thread (from inside the callable), or done.
+            if (running_ != node || cancelling_thread_ == std::this_thread::get_id()) {
+                return;
+            }
+        }
+        while (!node->completed.load(std::memory_order_acquire)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /**
+     * @brief Marks cancelled, and runs every registered callback.
+     *
+     * @returns False if cancellation was already requested.
+     */
+    bool requestCancellation() noexcept {
+        lock_.lock();
+        if (cancelled_.load(std::memory_order_relaxed)) {
+            lock_.unlock();
+            return false;
+        }
+        cancelled_.store(true, std::memory_order_release);
+        cancelling_thread_ = std::this_thread::get_id();
+
+        while (head_ != nullptr) {
+            CancellationCallbackNode* node = head_;
+            unlink(node);
+            running_ = node;
+            lock_.unlock();
+
+            node->invoke(node);
+            // Last touch, the owner may destroy node right after.
+            node->completed.store(true, std::memory_order_release);
+
+            lock_.lock();
+            running_ = nullptr;
+        }
+        lock_.unlock();
+        return true;
+    }
+
+private:
+    void unlink(CancellationCallbackNode* node) noexcept {
+        if (node->previous != nullptr) {
+            node->previous->next = node->next;
+        } else {
+            head_ = node->next;
+        }
+        if (node->next != nullptr) {
+            node->next->previous = node->previous;
+        }
+        node->linked = false;
+    }
+
+    /// Source and token references
+    std::atomic<::mystic::types::uint32_t> references_{1};
+
+    /// Set once cancellation is requested
+    std::atomic<bool> cancelled_{false};
+
+    /// Guards the callback list
+    concurrency::word_lock lock_;
+
+    /// Registered callbacks
+    CancellationCallbackNode* head_ = nullptr;
+
+    /// Callback being run by the cancelling thread
+    CancellationCallbackNode* running_ = nullptr;
+
+    /// Thread which requested cancellation
+    std::thread::id cancelling_thread_;
+
+}; // class CancellationState
+
+} // namespace mystic::async::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::async
+ * @brief Coroutine-based asynchronous primitives.
+ */
+namespace async {
+
+template <typename Callback>
+class cancellation_callback;
+
+/**
+ * @brief Observes cancellation requested through a cancellation_source.
+ */
+class cancellation_token {
+public:
+    /**
+     * @brief Constructs a token which is never cancelled.
+     */
+    cancellation_token() noexcept = default;
+
+    cancellation_token(const cancellation_token& other) noexcept : state_(other.state_) {
+        if (state_ != nullptr) {
+            state_->addRef();
+        }
+    }
+
+    cancellation_token(cancellation_token&& other) noexcept
+        : state_(std::exchange(other.state_, nullptr)) {}
+
+    cancellation_token& operator=(cancellation_token other) noexcept {
+        std::swap(state_, other.state_);
+        return *this;
+    }
+
+    ~cancellation_token() {
+        if (state_ != nullptr) {
+            state_->release();
+        }
+    }
+
+    /**
+     * @brief Returns true if cancellation was requested.
+     */
+    MYSTIC_NODISCARD bool is_cancellation_requested() const noexcept {
+        return state_ != nullptr && state_->isCancelled();
+    }
+
+    /**
+     * @brief Returns false for tokens which are never cancelled.
+     */
+    MYSTIC_NODISCARD bool can_be_cancelled() const noexcept { return state_ != nullptr; }
+
+    /**
+     * @brief Returns StatusCode::CANCELLED if cancellation was requested,
+     * else StatusCode::OK.
+     */
+    MYSTIC_NODISCARD status::StatusCode status() const noexcept {
+        return is_cancellation_requested() ? status::StatusCode::CANCELLED
+                                           : status::StatusCode::OK;
+    }
+
+private:
+    friend class cancellation_source;
+
+    template <typename Callback>
+    friend class cancellation_callback;
+
+    explicit cancellation_token(internal::CancellationState* state) noexcept : state_(state) {
+        state_->addRef();
+    }
+
+    /// Shared state, nullptr if never cancelled
+    internal::CancellationState* state_ = nullptr;
+
+}; // class cancellation_token
+
+/**
+ * @brief Requests cancellation, copies share the same state.
+ */
+class cancellation_source {
+public:
+    cancellation_source() : state_(new internal::CancellationState()) {}
+
+    cancellation_source(const cancellation_source& other) noexcept : state_(other.state_) {
+        state_->addRef();
+    }
+
+    cancellation_source& operator=(const cancellation_source& other) noexcept {
+        other.state_->addRef();
+        state_->release();
+        state_ = other.state_;
+        return *this;
+    }
+
+    ~cancellation_source() { state_->release(); }
+
+    /**
+     * @brief Returns a token observing this source.
+     */
+    MYSTIC_NODISCARD cancellation_token token() const noexcept {
+        return cancellation_token(state_);
+    }
+
+    /**
+     * @brief Requests cancellation, and runs the registered callbacks on the
+     * calling thread.
+     *
+     * @returns False if cancellation was already requested.
+     */
+    bool request_cancellation() noexcept { return state_->requestCancellation(); }
+
+    /**
+     * @brief Returns true if cancellation was requested.
+     */
+    MYSTIC_NODISCARD bool is_cancellation_requested() const noexcept {
+        return state_->isCancelled();
+    }
+
+private:
+    /// Shared state
+    internal::CancellationState* state_;
+
+}; // class cancellation_source
+
+/**
+ * @brief Runs a callable once, when cancellation is requested, while in scope.
+ * Runs it right away if cancellation was already requested.
+ *
+ * @tparam Callback A noexcept-invocable callable.
+ */
+template <typename Callback>
+class cancellation_callback : private internal::CancellationCallbackNode {
+public:
+    cancellation_callback(const cancellation_token& token, Callback callback) noexcept
+        : callback_(std::move(callback)) {
+        if (token.state_ == nullptr) {
+            return;
+        }
+        invoke = &cancellation_callback::invokeCallback;
+        if (token.state_->addCallback(this)) {
+            state_ = token.state_;
+            state_->addRef();
+        } else {
+            callback_();
+        }
+    }
+
+    cancellation_callback(const cancellation_callback&) = delete;
+    cancellation_callback& operator=(const cancellation_callback&) = delete;
+
+    ~cancellation_callback() {
+        if (state_ != nullptr) {
+            state_->removeCallback(this);
+            state_->release();
+        }
+    }
+
+private:
+    static void invokeCallback(internal::CancellationCallbackNode* node) noexcept {
+        static_cast<cancellation_callback*>(node)->callback_();
+    }
+
+    /// The callable
+    Callback callback_;
+
+    /// Registered state, nullptr if not registered
+    internal::CancellationState* state_ = nullptr;
+
+}; // class cancellation_callback
+
+template <typename Callback>
+cancellation_callback(const cancellation_token&, Callback) -> cancellation_callback<Callback>;
+
+/**
+ * @brief A point on the monotonic clock after which work is pointless.
+ */
+class deadline {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructs a deadline which never expires.
+     */
+    constexpr deadline() noexcept : when_(clock::time_point::max()) {}
+
+    /**
+     * @brief Constructs a deadline at when.
+     */
+    constexpr explicit deadline(clock::time_point when) noexcept : when_(when) {}
+
+    /**
+     * @brief Returns a deadline which never expires.
+     */
+    static constexpr deadline never() noexcept { return deadline(); }
+
+    /**
+     * @brief Returns a deadline timeout from now. A timeout beyond the
+     * clock's range never expires, a non-positive one already expired.
+     */
+    template <typename Rep, typename Period>
+    static deadline after(const std::chrono::duration<Rep, Period>& timeout) noexcept {
+        using wide_duration = std::chrono::duration<double, clock::period>;
+        const clock::time_point now = clock::now();
+        // Compared in floating point first, as the cast itself may overflow.
+        if (wide_duration(timeout) >= wide_duration(clock::time_point::max() - now)) {
+            return never();
+        }
+        if (!(timeout > std::chrono::duration<Rep, Period>::zero())) {
+            return deadline(now);
+        }
+        return deadline(now + std::chrono::duration_cast<clock::duration>(timeout));
+    }
+
+    /**
+     * @brief Returns true if this deadline never expires.
+     */
+    constexpr bool is_never() const noexcept { return when_ == clock::time_point::max(); }
+
+    /**
+     * @brief Returns true if the deadline passed.
+     */
+    MYSTIC_NODISCARD bool expired() const noexcept {
+        return !is_never() && clock::now() >= when_;
+    }
+
+    /**
+     * @brief Returns true if the deadline passed at now, for callers which
+     * already read the clock.
+     */
+    MYSTIC_NODISCARD constexpr bool expired(clock::time_point now) const noexcept {
+        return now >= when_;
+    }
+
+    /**
+     * @brief Returns StatusCode::DEADLINE_EXCEEDED if the deadline passed,
+     * else StatusCode::OK.
+     */
+    MYSTIC_NODISCARD status::StatusCode status() const noexcept {
+        return expired() ? status::StatusCode::DEADLINE_EXCEEDED : status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Returns the time left, zero once expired.
+     */
+    clock::duration remaining() const noexcept {
+        if (is_never()) {
+            return clock::duration::max();
+        }
+        const clock::duration left = when_ - clock::now();
+        return left > clock::duration::zero() ? left : clock::duration::zero();
+    }
+
+    /**
+     * @brief Returns the time point of the deadline.
+     */
+    constexpr clock::time_point when() const noexcept { return when_; }
+
+    /**
+     * @brief Returns the earlier of two deadlines, to propagate a caller's
+     * deadline into a callee with its own budget.
+     */
+    static constexpr deadline earliest(const deadline& first, const deadline& second) noexcept {
+        return first.when_ < second.when_ ? first : second;
+    }
+
+private:
+    /// Expiry, time_point::max() for never
+    clock::time_point when_;
+
+}; // class deadline
+
+/**
+ * @brief Returns CANCELLED if token was cancelled, DEADLINE_EXCEEDED if
+ * until passed, else OK.
+ */
+MYSTIC_NODISCARD inline status::StatusCode check(const cancellation_token& token,
+                                                 const deadline& until = deadline::never()) noexcept {
+    if (MYSTIC_UNLIKELY(token.is_cancellation_requested())) {
+        return status::StatusCode::CANCELLED;
+    }
+    return until.status();
+}
+
+} // namespace async
+} // namespace mystic
@@ -0,0 +1,348 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/async/executor.hpp
+ * @file executor.hpp
+ * @brief Defines thread pool executor for coroutine tasks.
+ *
+ * @details
+ * This header provides,
+ * 1. `thread_pool_executor`, a small executor which resumes coroutines on
+ *    a fixed set of worker threads. Scheduling is intrusive, the queued
+ *    node lives inside the awaiting coroutine's frame, so scheduling never
+ *    allocates.
+ * 2. `sync_wait()`, which blocks the calling thread until a task completes.
+ *
+ * @code{.cpp}
+ * #include "mystic/async/executor.hpp"
+ *
+ * mystic::async::task<> collect(mystic::async::thread_pool_executor& pool) {
+ *     co_await pool.schedule();
+ *     // ... now running on a worker thread
+ *     co_return mystic::status::StatusCode::OK;
+ * }
+ *
+ * // ... somewhere in code
+ * mystic::async::thread_pool_executor pool(4);
+ * pool.spawn(collect(pool));                        // fire and forget
+ * auto code = mystic::async::sync_wait(collect(pool)); // or block on it
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <condition_variable>
+#include <coroutine>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "mystic/async/internal/frame_pool.hpp"
+#include "mystic/async/task.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+
+namespace mystic::async::internal {
+
+/**
+ * @brief Eagerly started coroutine which destroys itself on completion.
+ */
+struct DetachedTask {
+    struct promise_type : PooledFrame {
+        DetachedTask get_return_object() const noexcept { return {}; }
+        std::suspend_never initial_suspend() const noexcept { return {}; }
+        std::suspend_never final_suspend() const noexcept { return {}; }
+        void return_void() const noexcept {}
+        [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+    }; // struct promise_type
+}; // struct DetachedTask
+
+} // namespace mystic::async::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::async
+ * @brief Coroutine-based asynchronous primitives.
+ */
+namespace async {
+
+/**
+ * @brief Fixed size pool of worker threads resuming coroutines.
+ */
+class thread_pool_executor {
+public:
+    /**
+     * @brief Awaitable which resumes the awaiting coroutine on a worker.
+     */
+    class schedule_operation {
+    public:
+        explicit schedule_operation(thread_pool_executor& executor) noexcept
+            : executor_(&executor) {}
+
+        bool await_ready() const noexcept { return false; }
+
+        bool await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle_ = awaiting;
+            return executor_->enqueue(this);
+        }
+
+        void await_resume() const noexcept {}
+
+    private:
+        friend class thread_pool_executor;
+
+        /// Owning executor
+        thread_pool_executor* executor_;
+
+        /// Coroutine to resume
+        std::coroutine_handle<> handle_;
+
+        /// Next queued operation
+        schedule_operation* next_ = nullptr;
+
+    }; // class schedule_operation
+
+    /**
+     * @brief Starts thread_count worker threads (at least one).
+     */
+    explicit thread_pool_executor(
+        ::mystic::types::size_t thread_count = std::thread::hardware_concurrency()) {
+        if (thread_count == 0) {
+            thread_count = 1;
+        }
+        workers_.reserve(thread_count);
+        live_workers_ = thread_count;
+        for (::mystic::types::size_t index = 0; index < thread_count; ++index) {
+            workers_.emplace_back([this] { run(); });
+        }
+    }
+
+    thread_pool_executor(const thread_pool_executor&) = delete;
+    thread_pool_executor& operator=(const thread_pool_executor&) = delete;
+
+    /**
+     * @brief Drains the queue, then stops and joins every worker.
+     *
+     * @pre Not called from one of this executor's workers, which would
+     *      still run its loop on the destroyed executor.
+     */
+    ~thread_pool_executor() { shutdown(); }
+
+    /**
+     * @brief Returns an awaitable moving the awaiter onto a worker thread.
+     * Once shutdown() stopped every worker, the awaiter resumes inline.
+     */
+    MYSTIC_NODISCARD schedule_operation schedule() noexcept {
+        return schedule_operation{*this};
+    }
+
+    /**
+     * @brief Runs the task on a worker thread, without waiting for it.
+     * The resulting StatusCode is discarded. After shutdown(), the task
+     * runs inline on the calling thread instead.
+     */
+    void spawn(task<void>&& work) {
+        runDetached(*this, std::move(work));
+    }
+
+    /**
+     * @brief Drains the queue, then stops and joins every worker.
+     * Safe to call more than once, and from a task running on a worker:
+     * that worker is detached instead, and exits once the task returns.
+     * Other callers return once every worker exited.
+     */
+    void shutdown() {
+        const bool on_worker = currentExecutor() == this;
+        bool first = false;
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            first = !stopping_;
+            stopping_ = true;
+        }
+        if (first) {
+            wakeup_.notify_all();
+            const std::thread::id self = std::this_thread::get_id();
+            for (std::thread& worker : workers_) {
+                if (!worker.joinable()) {
+                    continue;
+                }
+                if (on_worker && worker.get_id() == self) {
+                    // Joining itself would throw.
+                    worker.detach();
+                } else {
+                    worker.join();
+                }
+            }
+        }
+        if (!on_worker) {
+            // A worker which detached itself may still be running.
+            std::unique_lock<std::mutex> lock(mutex_);
+            wakeup_.wait(lock, [this] { return live_workers_ == 0; });
+        }
+    }
+
+    /**
+     * @brief Returns the number of worker threads.
+     */
+    ::mystic::types::size_t thread_count() const noexcept { return workers_.size(); }
+
+private:
+    /**
+     * @brief Coroutine backing spawn(), it owns the task.
+     */
+    static internal::DetachedTask runDetached(thread_pool_executor& executor,
+                                              task<void> work) {
+        co_await executor.schedule();
+        static_cast<void>(co_await std::move(work));
+    }
+
+    /**
+     * @brief Appends an operation to the intrusive run queue.
+     *
+     * @returns False if no worker is left to run it, the caller resumes it.
+     */
+    bool enqueue(schedule_operation* operation) noexcept {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (MYSTIC_UNLIKELY(live_workers_ == 0)) {
+                return false;
+            }
+            operation->next_ = nullptr;
+            if (tail_ != nullptr) {
+                tail_->next_ = operation;
+            } else {
+                head_ = operation;
+            }
+            tail_ = operation;
+        }
+        wakeup_.notify_one();
+        return true;
+    }
+
+    /**
+     * @brief Returns the executor whose worker is the calling thread, or
+     * nullptr.
+     */
+    static thread_pool_executor*& currentExecutor() noexcept {
+        thread_local thread_pool_executor* executor = nullptr;
+        return executor;
+    }
+
+    /**
+     * @brief Worker loop.
+     */
+    void run() {
+        currentExecutor() = this;
+        for (;;) {
+            schedule_operation* operation = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(mutex_);
+                wakeup_.wait(lock, [this] { return head_ != nullptr || stopping_; });
+                if (head_ == nullptr) {
+                    // Under the lock, so enqueue() sees the last exit.
+                    if (--live_workers_ == 0) {
+                        wakeup_.notify_all();
+                    }
+                    return;
+                }
+                operation = head_;
+                head_ = operation->next_;
+                if (head_ == nullptr) {
+                    tail_ = nullptr;
+                }
+            }
+            operation->handle_.resume();
+        }
+    }
+
+    /// Run queue guard and signal
+    std::mutex mutex_;
+    std::condition_variable wakeup_;
+
+    /// Intrusive run queue
+    schedule_operation* head_ = nullptr;
+    schedule_operation* tail_ = nullptr;
+
+    /// Set once shutdown() is called
+    bool stopping_ = false;
+
+    /// Number of workers which have not exited
+    ::mystic::types::size_t live_workers_ = 0;
+
+    /// Worker threads
+    std::vector<std::thread> workers_;
+
+}; // class thread_pool_executor
+
+namespace internal {
+
+/**
+ * @brief Completion signal of sync_wait().
+ */
+struct SyncWaitState {
+    std::mutex mutex;
+    std::condition_variable signal;
+    bool done = false;
+}; // struct SyncWaitState
+
+/**
+ * @brief Runs the task, stores its result, and signals completion.
+ */
+template <typename T>
+DetachedTask runSyncWait(task<T> work,
+                         typename task<T>::result_type& result,
+                         SyncWaitState& state) {
+    result = co_await std::move(work);
+
+    // Notify under the lock, the waiter destroys state as soon as it wakes.
+    std::lock_guard<std::mutex> lock(state.mutex);
+    state.done = true;
+    state.signal.notify_one();
+}
+
+} // namespace internal
+
+/**
+ * @brief Runs the task on the calling thread, blocking until it completes.
+ *
+ * @returns StatusOr<T> for task<T>, or StatusCode for task<void>.
+ */
+template <typename T>
+MYSTIC_NODISCARD typename task<T>::result_type sync_wait(task<T>&& work) {
+    typename task<T>::result_type result{::mystic::status::StatusCode::UNKNOWN};
+    internal::SyncWaitState state;
+    internal::runSyncWait<T>(std::move(work), result, state);
+
+    std::unique_lock<std::mutex> lock(state.mutex);
+    state.signal.wait(lock, [&state] { return state.done; });
+    return result;
+}
+
+} // namespace async
+} // namespace mystic
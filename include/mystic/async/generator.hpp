@@ -0,0 +1,224 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/async/generator.hpp
+ * @file generator.hpp
+ * @brief Defines synchronous coroutine generator type.
+ *
+ * @details
+ * This header provides `mystic::async::generator<T>`, a coroutine which
+ * lazily yields a sequence of T, consumed through a range-based for loop.
+ * Frames come from the same per-thread recycled frame pool as task<T>.
+ *
+ * @code{.cpp}
+ * #include "mystic/async/generator.hpp"
+ *
+ * mystic::async::generator<int> iota(int count) {
+ *     for (int value = 0; value < count; ++value) {
+ *         co_yield value;
+ *     }
+ * }
+ *
+ * // ... somewhere in code
+ * for (int value : iota(10)) {
+ *     use(value);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/standard_detection.hpp"
+
+/**
+ * @brief Coroutines need C++20, stop compilation otherwise.
+ */
+#if (MYSTIC_ARCH_STANDARD < MYSTIC_ARCH_STANDARD_CPP20)
+# error "[Mystic Framework] - Async - Coroutines require C++20, consider compiling with C++20 or later."
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/async/internal/frame_pool.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::async
+ * @brief Coroutine-based asynchronous primitives.
+ */
+namespace async {
+
+/**
+ * @brief Lazily evaluated sequence of T.
+ *
+ * @tparam T The yielded type.
+ */
+template <typename T>
+class generator {
+public:
+    using value_type = std::remove_cvref_t<T>;
+    using reference = std::conditional_t<std::is_reference_v<T>, T, const value_type&>;
+    using pointer = std::add_pointer_t<reference>;
+
+    /**
+     * @brief Promise of generator, keeps a pointer to the last yielded value.
+     */
+    class promise_type : public internal::PooledFrame {
+    public:
+        generator get_return_object() noexcept {
+            return generator{std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+
+        std::suspend_always initial_suspend() const noexcept { return {}; }
+        std::suspend_always final_suspend() const noexcept { return {}; }
+
+        /**
+         * @brief Yields a value, which lives in the frame until resumed.
+         */
+        std::suspend_always yield_value(std::remove_reference_t<reference>& value) noexcept {
+            current_ = std::addressof(value);
+            return {};
+        }
+
+        std::suspend_always yield_value(std::remove_reference_t<reference>&& value) noexcept {
+            current_ = std::addressof(value);
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        /**
+         * @brief Exceptions are not part of our error model.
+         */
+        [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+        /**
+         * @brief Disallow co_await inside generators.
+         */
+        template <typename U>
+        std::suspend_never await_transform(U&&) = delete;
+
+        reference value() const noexcept { return static_cast<reference>(*current_); }
+
+    private:
+        /// Last yielded value
+        pointer current_ = nullptr;
+
+    }; // class promise_type
+
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /**
+     * @brief Sentinel marking the end of the sequence.
+     */
+    struct sentinel {};
+
+    /**
+     * @brief Input iterator over the yielded values.
+     */
+    class iterator {
+    public:
+        using iterator_category = std::input_iterator_tag;
+        using difference_type = ::mystic::types::ptrdiff_t;
+        using value_type = generator::value_type;
+        using reference = generator::reference;
+        using pointer = generator::pointer;
+
+        iterator() noexcept = default;
+        explicit iterator(handle_type handle) noexcept : handle_(handle) {}
+
+        reference operator*() const noexcept { return handle_.promise().value(); }
+        pointer operator->() const noexcept { return std::addressof(operator*()); }
+
+        iterator& operator++() {
+            handle_.resume();
+            return *this;
+        }
+
+        void operator++(int) { ++*this; }
+
+        friend bool operator==(const iterator& it, sentinel) noexcept {
+            return !it.handle_ || it.handle_.done();
+        }
+
+    private:
+        /// Borrowed coroutine
+        handle_type handle_;
+
+    }; // class iterator
+
+    generator() noexcept = default;
+    explicit generator(handle_type handle) noexcept : handle_(handle) {}
+
+    generator(const generator&) = delete;
+    generator& operator=(const generator&) = delete;
+
+    generator(generator&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    generator& operator=(generator&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~generator() { destroy(); }
+
+    /**
+     * @brief Starts the generator and returns an iterator to the first value.
+     */
+    iterator begin() {
+        if (handle_) {
+            handle_.resume();
+        }
+        return iterator{handle_};
+    }
+
+    sentinel end() const noexcept { return {}; }
+
+private:
+    void destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    /// Owned coroutine
+    handle_type handle_;
+
+}; // class generator
+
+} // namespace async
+} // namespace mystic
@@ -0,0 +1,303 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/async/internal/frame_pool.hpp
+ * @file frame_pool.hpp
+ * @brief Per-thread recycled pool for coroutine frames.
+ *
+ * @details
+ * Coroutine frames are allocated through the promise's `operator new`.
+ * Instead of going to the global heap for every frame, frames are carved
+ * in size classes of 64 bytes and kept on per-thread free lists when
+ * released, so a steady-state workload recycles the same frames.
+ *
+ * A pooled frame is preceded by a header naming the inbox of the pool it
+ * was carved by. A frame released on its own thread goes straight back to
+ * the free list. One released elsewhere (a task spawned on one thread and
+ * finished on a worker) is pushed on the owner's inbox, a lock-free stack
+ * the owner takes whole once a free list runs dry. Inboxes outlive their
+ * thread and are reused by later threads, so late releases stay valid.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic::async::internal
+ * @brief Internal implementation details of async.
+ *
+ * @details
+ * This namespace contains internal implementation details of async.
+ * **It should not be used directly.**
+ */
+namespace mystic::async::internal {
+
+/**
+ * @brief Intrusive free list node, lives inside the released frame.
+ */
+struct FrameFreeNode {
+    FrameFreeNode* next;
+}; // struct FrameFreeNode
+
+/**
+ * @brief Stack of frames released by threads other than their owner.
+ */
+struct FrameInbox {
+    /// Released frames, or closedMarker() while no thread owns the inbox
+    std::atomic<FrameFreeNode*> head{nullptr};
+
+    /// Next unowned inbox (guarded by the inbox list mutex)
+    FrameInbox* next_unowned = nullptr;
+
+    /**
+     * @brief Returns the head of an unowned inbox, whose frames go back to
+     * the heap.
+     */
+    static FrameFreeNode* closedMarker() noexcept {
+        static FrameFreeNode marker{nullptr};
+        return &marker;
+    }
+}; // struct FrameInbox
+
+/**
+ * @brief Inboxes of exited threads, reused by new ones. Inboxes are
+ * leaked, frames released after their owner exited may still refer to
+ * them.
+ */
+class FrameInboxList {
+public:
+    static FrameInboxList& instance() noexcept {
+        static FrameInboxList* list = new FrameInboxList();
+        return *list;
+    }
+
+    FrameInbox* acquire() {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            if (unowned_ != nullptr) {
+                FrameInbox* inbox = unowned_;
+                unowned_ = inbox->next_unowned;
+                inbox->head.store(nullptr, std::memory_order_relaxed);
+                return inbox;
+            }
+        }
+        return new FrameInbox();
+    }
+
+    void release(FrameInbox* inbox) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        inbox->next_unowned = unowned_;
+        unowned_ = inbox;
+    }
+
+private:
+    FrameInboxList() = default;
+
+    std::mutex mutex_;
+    FrameInbox* unowned_ = nullptr;
+
+}; // class FrameInboxList
+
+/**
+ * @brief Per-thread pool of recycled coroutine frames.
+ */
+class FramePool {
+public:
+    /// Granularity of a size class, in bytes.
+    static constexpr ::mystic::types::size_t kClassGranularity = 64;
+
+    /// Number of size classes, frames above the last class use the heap.
+    static constexpr ::mystic::types::size_t kClassCount = 32;
+
+    /// Maximum number of cached frames per size class.
+    static constexpr ::mystic::types::uint32_t kMaxCachedPerClass = 256;
+
+    FramePool() : inbox_(FrameInboxList::instance().acquire()) {}
+    FramePool(const FramePool&) = delete;
+    FramePool& operator=(const FramePool&) = delete;
+
+    /**
+     * @brief Releases every cached frame back to the heap, and closes the
+     * inbox, later releases from other threads go to the heap.
+     */
+    ~FramePool() {
+        for (::mystic::types::size_t index = 0; index < kClassCount; ++index) {
+            FrameFreeNode* node = heads_[index];
+            while (node != nullptr) {
+                FrameFreeNode* next = node->next;
+                ::operator delete(blockOf(node));
+                node = next;
+            }
+            heads_[index] = nullptr;
+            counts_[index] = 0;
+        }
+        FrameFreeNode* node =
+            inbox_->head.exchange(FrameInbox::closedMarker(), std::memory_order_acquire);
+        while (node != nullptr) {
+            FrameFreeNode* next = node->next;
+            ::operator delete(blockOf(node));
+            node = next;
+        }
+        FrameInboxList::instance().release(inbox_);
+    }
+
+    /**
+     * @brief Returns the pool of calling thread.
+     */
+    static FramePool& local() {
+        thread_local FramePool pool;
+        return pool;
+    }
+
+    /**
+     * @brief Allocates a frame of at least size bytes.
+     */
+    void* allocate(::mystic::types::size_t size) {
+        const ::mystic::types::size_t index = classIndex(size);
+        if (MYSTIC_UNLIKELY(index >= kClassCount)) {
+            return ::operator new(size);
+        }
+
+        if (MYSTIC_UNLIKELY(heads_[index] == nullptr) &&
+            inbox_->head.load(std::memory_order_relaxed) != nullptr) {
+            reclaim();
+        }
+        FrameFreeNode* node = heads_[index];
+        if (MYSTIC_LIKELY(node != nullptr)) {
+            heads_[index] = node->next;
+            --counts_[index];
+            return static_cast<void*>(node);
+        }
+
+        void* block = ::operator new(sizeof(FrameHeader) + (index + 1) * kClassGranularity);
+        FrameHeader* header = ::new (block) FrameHeader{inbox_, index};
+        return static_cast<void*>(header + 1);
+    }
+
+    /**
+     * @brief Returns a frame of size bytes to the pool that carved it.
+     */
+    void deallocate(void* frame, ::mystic::types::size_t size) noexcept {
+        const ::mystic::types::size_t index = classIndex(size);
+        if (MYSTIC_UNLIKELY(index >= kClassCount)) {
+            ::operator delete(frame);
+            return;
+        }
+
+        auto* node = static_cast<FrameFreeNode*>(frame);
+        FrameInbox* owner = headerOf(node)->owner;
+        if (MYSTIC_LIKELY(owner == inbox_)) {
+            cache(node, index);
+            return;
+        }
+
+        FrameFreeNode* head = owner->head.load(std::memory_order_relaxed);
+        do {
+            if (MYSTIC_UNLIKELY(head == FrameInbox::closedMarker())) {
+                ::operator delete(blockOf(node));
+                return;
+            }
+            node->next = head;
+        } while (!owner->head.compare_exchange_weak(head, node, std::memory_order_release,
+                                                    std::memory_order_relaxed));
+    }
+
+private:
+    /**
+     * @brief Precedes every pooled frame, keeping its alignment.
+     */
+    struct alignas(std::max_align_t) FrameHeader {
+        FrameInbox* owner;
+        ::mystic::types::size_t size_class;
+    }; // struct FrameHeader
+
+    static FrameHeader* headerOf(FrameFreeNode* node) noexcept {
+        return reinterpret_cast<FrameHeader*>(node) - 1;
+    }
+
+    static void* blockOf(FrameFreeNode* node) noexcept { return headerOf(node); }
+
+    /**
+     * @brief Maps a frame size to its size class.
+     */
+    static constexpr ::mystic::types::size_t classIndex(::mystic::types::size_t size) noexcept {
+        return (size + kClassGranularity - 1) / kClassGranularity - 1;
+    }
+
+    /**
+     * @brief Puts a frame of this pool on its free list, or back to the
+     * heap if the list is full.
+     */
+    void cache(FrameFreeNode* node, ::mystic::types::size_t index) noexcept {
+        if (MYSTIC_UNLIKELY(counts_[index] >= kMaxCachedPerClass)) {
+            ::operator delete(blockOf(node));
+            return;
+        }
+        node->next = heads_[index];
+        heads_[index] = node;
+        ++counts_[index];
+    }
+
+    /**
+     * @brief Moves the frames other threads released to the free lists.
+     */
+    MYSTIC_NOINLINE void reclaim() noexcept {
+        FrameFreeNode* node = inbox_->head.exchange(nullptr, std::memory_order_acquire);
+        while (node != nullptr) {
+            FrameFreeNode* next = node->next;
+            cache(node, headerOf(node)->size_class);
+            node = next;
+        }
+    }
+
+    /// Where other threads return this pool's frames
+    FrameInbox* inbox_;
+
+    /// Free list heads, one per size class
+    FrameFreeNode* heads_[kClassCount] = {};
+
+    /// Number of cached frames, one per size class
+    ::mystic::types::uint32_t counts_[kClassCount] = {};
+
+}; // class FramePool
+
+/**
+ * @brief Mixin giving a promise type pooled frame allocation.
+ */
+struct PooledFrame {
+    static void* operator new(::mystic::types::size_t size) {
+        return FramePool::local().allocate(size);
+    }
+
+    static void operator delete(void* frame, ::mystic::types::size_t size) noexcept {
+        FramePool::local().deallocate(frame, size);
+    }
+}; // struct PooledFrame
+
+} // namespace mystic::async::internal
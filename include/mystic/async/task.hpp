@@ -0,0 +1,304 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/async/task.hpp
+ * @file task.hpp
+ * @brief Defines lazy coroutine task type.
+ *
+ * @details
+ * This header provides `mystic::async::task<T>`, a lazily started coroutine
+ * which produces either a T, or a StatusCode describing why it could not.
+ *
+ * 1. Tasks start only when awaited, and resume their awaiter through
+ *    symmetric transfer, so deep await chains never grow the stack.
+ * 2. Frames come from a per-thread recycled frame pool, not the heap.
+ * 3. Errors are propagated as StatusCode, as we don't use exceptions.
+ *    `co_await`ing a task<T> yields a StatusOr<T>, and `co_await`ing a
+ *    task<void> yields a StatusCode.
+ *
+ * @code{.cpp}
+ * #include "mystic/async/task.hpp"
+ *
+ * using mystic::status::StatusCode;
+ *
+ * mystic::async::task<int> read_value() {
+ *     if (!connected()) {
+ *         co_return StatusCode::UNAVAILABLE;
+ *     }
+ *     co_return 42;
+ * }
+ *
+ * mystic::async::task<> collect() {
+ *     auto value = co_await read_value();
+ *     if (!value.ok()) {
+ *         co_return value.code();
+ *     }
+ *     store(*value);
+ *     co_return StatusCode::OK;
+ * }
+ * @endcode
+ *
+ * @note
+ * task<void> coroutines must end with `co_return <StatusCode>;`.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/standard_detection.hpp"
+
+/**
+ * @brief Coroutines need C++20, stop compilation otherwise.
+ */
+#if (MYSTIC_ARCH_STANDARD < MYSTIC_ARCH_STANDARD_CPP20)
+# error "[Mystic Framework] - Async - Coroutines require C++20, consider compiling with C++20 or later."
+#endif
+
+#include <coroutine>
+#include <exception>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/async/internal/frame_pool.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/status/status_or.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::async
+ * @brief Coroutine-based asynchronous primitives.
+ */
+namespace async {
+
+/// Forward declaration of task
+template <typename T = void>
+class task;
+
+} // namespace async
+} // namespace mystic
+
+namespace mystic::async::internal {
+
+/**
+ * @brief Common part of every task promise.
+ */
+class TaskPromiseBase : public PooledFrame {
+public:
+    /**
+     * @brief Final awaiter, transfers control to the awaiting coroutine.
+     */
+    struct FinalAwaiter {
+        bool await_ready() const noexcept { return false; }
+
+        template <typename Promise>
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<Promise> self) noexcept {
+            std::coroutine_handle<> continuation = self.promise().continuation_;
+            return continuation ? continuation : std::noop_coroutine();
+        }
+
+        void await_resume() const noexcept {}
+    }; // struct FinalAwaiter
+
+    /**
+     * @brief Tasks are lazy, they start when awaited.
+     */
+    std::suspend_always initial_suspend() const noexcept { return {}; }
+
+    FinalAwaiter final_suspend() const noexcept { return {}; }
+
+    /**
+     * @brief Exceptions are not part of our error model.
+     */
+    [[noreturn]] void unhandled_exception() const noexcept { std::terminate(); }
+
+    /**
+     * @brief Sets the coroutine to resume once this one completes.
+     */
+    void setContinuation(std::coroutine_handle<> continuation) noexcept {
+        continuation_ = continuation;
+    }
+
+private:
+    /// Awaiting coroutine
+    std::coroutine_handle<> continuation_;
+
+}; // class TaskPromiseBase
+
+/**
+ * @brief Promise of task<T>, stores the produced StatusOr<T>.
+ */
+template <typename T>
+class TaskPromise final : public TaskPromiseBase {
+public:
+    ::mystic::async::task<T> get_return_object() noexcept;
+
+    /**
+     * @brief Accepts a value, or a StatusCode.
+     */
+    template <typename U>
+    void return_value(U&& value) {
+        result_ = ::mystic::status::StatusOr<T>(std::forward<U>(value));
+    }
+
+    /**
+     * @brief Moves out the result.
+     */
+    ::mystic::status::StatusOr<T> takeResult() noexcept {
+        return std::move(result_);
+    }
+
+private:
+    /// Result of the coroutine
+    ::mystic::status::StatusOr<T> result_{::mystic::status::StatusCode::UNKNOWN};
+
+}; // class TaskPromise
+
+/**
+ * @brief Promise of task<void>, stores the produced StatusCode.
+ */
+template <>
+class TaskPromise<void> final : public TaskPromiseBase {
+public:
+    ::mystic::async::task<void> get_return_object() noexcept;
+
+    void return_value(::mystic::status::StatusCode code) noexcept { result_ = code; }
+
+    ::mystic::status::StatusCode takeResult() noexcept { return result_; }
+
+private:
+    /// Result of the coroutine
+    ::mystic::status::StatusCode result_ = ::mystic::status::StatusCode::UNKNOWN;
+
+}; // class TaskPromise<void>
+
+} // namespace mystic::async::internal
+
+namespace mystic::async {
+
+/**
+ * @brief Lazily started coroutine producing a T, or a StatusCode.
+ *
+ * @tparam T The produced type, `void` for tasks producing only a StatusCode.
+ */
+template <typename T>
+class MYSTIC_NODISCARD task {
+public:
+    using promise_type = internal::TaskPromise<T>;
+    using handle_type = std::coroutine_handle<promise_type>;
+
+    /// Result of awaiting this task
+    using result_type = std::conditional_t<std::is_void_v<T>,
+                                           ::mystic::status::StatusCode,
+                                           ::mystic::status::StatusOr<T>>;
+
+    /**
+     * @brief Awaiter, starts the task and resumes the awaiter when it completes.
+     */
+    struct awaiter {
+        handle_type handle;
+
+        bool await_ready() const noexcept { return !handle || handle.done(); }
+
+        std::coroutine_handle<> await_suspend(std::coroutine_handle<> awaiting) noexcept {
+            handle.promise().setContinuation(awaiting);
+            return handle;
+        }
+
+        result_type await_resume() noexcept {
+            if (MYSTIC_UNLIKELY(!handle)) {
+                return ::mystic::status::StatusCode::FAILED_PRECONDITION;
+            }
+            return handle.promise().takeResult();
+        }
+    }; // struct awaiter
+
+    task() noexcept = default;
+    explicit task(handle_type handle) noexcept : handle_(handle) {}
+
+    task(const task&) = delete;
+    task& operator=(const task&) = delete;
+
+    task(task&& other) noexcept : handle_(std::exchange(other.handle_, {})) {}
+
+    task& operator=(task&& other) noexcept {
+        if (this != &other) {
+            destroy();
+            handle_ = std::exchange(other.handle_, {});
+        }
+        return *this;
+    }
+
+    ~task() { destroy(); }
+
+    /**
+     * @brief Returns true if the task holds a coroutine.
+     */
+    bool valid() const noexcept { return static_cast<bool>(handle_); }
+
+    /**
+     * @brief Returns true if the coroutine has run to completion.
+     */
+    bool done() const noexcept { return !handle_ || handle_.done(); }
+
+    /**
+     * @brief Awaits the task, it must be an rvalue (i.e., `co_await std::move(t)`).
+     */
+    awaiter operator co_await() && noexcept { return awaiter{handle_}; }
+
+    /**
+     * @brief Releases ownership of the coroutine handle.
+     */
+    handle_type release() noexcept { return std::exchange(handle_, {}); }
+
+private:
+    void destroy() noexcept {
+        if (handle_) {
+            handle_.destroy();
+            handle_ = {};
+        }
+    }
+
+    /// Owned coroutine
+    handle_type handle_;
+
+}; // class task
+
+} // namespace mystic::async
+
+namespace mystic::async::internal {
+
+template <typename T>
+::mystic::async::task<T> TaskPromise<T>::get_return_object() noexcept {
+    return ::mystic::async::task<T>{
+        std::coroutine_handle<TaskPromise<T>>::from_promise(*this)};
+}
+
+inline ::mystic::async::task<void> TaskPromise<void>::get_return_object() noexcept {
+    return ::mystic::async::task<void>{
+        std::coroutine_handle<TaskPromise<void>>::from_promise(*this)};
+}
+
+} // namespace mystic::async::internal
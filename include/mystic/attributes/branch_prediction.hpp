@@ -35,7 +35,7 @@
  * }
  *
  * // If compiler supports attribute (C++20+)
- * if (some_condition) MYSTIC_LIKELY {
+ * if (some_condition) MYSTIC_LIKELY_ATTRIBUTE {
  *     // Likely path
  * } else {
  *     // Unlikely path
@@ -72,10 +72,10 @@
 
 #else /* if non-supported */
 /**
- * @brief Define it as no-op.
+ * @brief Define it as the plain condition.
  */
-# define MYSTIC_LIKELY_EXPECT(x)
-# define MYSTIC_UNLIKELY_EXPECT(x)
+# define MYSTIC_LIKELY_EXPECT(x)   (x)
+# define MYSTIC_UNLIKELY_EXPECT(x) (x)
 
 #endif
 
@@ -103,31 +103,23 @@
 #endif
 
 /* =================================================
-    Dispatching Logic
+    Public Macros
    ------------------------------------------------- */
 
 /**
- * @macro MYSTIC_BRANCH_PREDICTION_DISPATCHER
- * @brief Dispatches macro based whether value was provided or not.
+ * @macro MYSTIC_LIKELY(x)
+ * @brief Public facing likely macro, wraps the condition.
+ *
+ * @note
+ * For the statement form (C++20+), use MYSTIC_LIKELY_ATTRIBUTE.
  */
-#define MYSTIC_BRANCH_PREDICTION_DISPATCHER(_1, N, ...) N
+#define MYSTIC_LIKELY(x) MYSTIC_LIKELY_EXPECT(x)
 
 /**
- * @macro MYSTIC_LIKELY
- * @brief Public facing likely macro.
- */
-#define MYSTIC_LIKELY(...) \
-    MYSTIC_BRANCH_PREDICTION_DISPATCHER(__VA_ARGS__, \
-            MYSTIC_LIKELY_ATTRIBUTE, \
-            MYSTIC_LIKELY_EXPECT, )()(__VA_ARGS__)
-
-
-/**
- * @macro MYSTIC_UNLIKELY
- * @brief Public facing unlikely macro.
+ * @macro MYSTIC_UNLIKELY(x)
+ * @brief Public facing unlikely macro, wraps the condition.
+ *
+ * @note
+ * For the statement form (C++20+), use MYSTIC_UNLIKELY_ATTRIBUTE.
  */
-#define MYSTIC_UNLIKELY(...) \
-    MYSTIC_BRANCH_PREDICTION_DISPATCHER(__VA_ARGS__, \
-            MYSTIC_UNLIKELY_ATTRIBUTE, \
-            MYSTIC_UNLIKELY_EXPECT, )()(__VA_ARGS__)
-
+#define MYSTIC_UNLIKELY(x) MYSTIC_UNLIKELY_EXPECT(x)
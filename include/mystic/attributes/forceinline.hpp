@@ -62,8 +62,10 @@
       (MYSTIC_ARCH_COMPILER == MYSTIC_ARCH_COMPILER_ICC) /* using Clang/GCC/ICC */
 /**
  * @brief Clang, GCC, and ICC use __attribute__((always_inline)).
+ * The attribute does not imply `inline` (unlike MSVC's __forceinline),
+ * so it is spelled out to keep header definitions ODR-safe.
  */
-# define MYSTIC_FORCEINLINE __attribute__((always_inline))
+# define MYSTIC_FORCEINLINE inline __attribute__((always_inline))
 
 #else /* if unknown */
 /**
@@ -86,28 +86,17 @@
 
 #endif
 
-/* ==================================================
-    Dispatching Logic
-   -------------------------------------------------- */
-
-/**
- * @macro MYSTIC_NODISCARD_MACRO_DISPATCHER
- * @brief Counts arguments and selects the appropriate macro.
- *
- * @details
- * The '...' will consume the variable arguments (including none).
- * The (N, ...) part defines the selection order.
- */
-#define MYSTIC_NODISCARD_MACRO_DISPATCHER(_1, N, ...) N
-
 /**
  * @macro MYSTIC_NODISCARD
  * @brief Public facing nodiscard macro.
  *
  * @details
- * - If NODISCARD(msg) is used, it resolves to NODISCARD_WITH_MSG.
- * - If NODISCARD() is used (or no arguments), it resolves to NODISCARD_NO_MSG.
+ * - MYSTIC_NODISCARD resolves to MYSTIC_NODISCARD_NO_MSG.
+ * - Use MYSTIC_NODISCARD_WITH_MSG(msg) directly when a reason is needed.
+ *
+ * @note
+ * This is an object-like macro, so it can be placed directly in front of
+ * declarations (i.e., `MYSTIC_NODISCARD int func();`), a variadic
+ * function-like macro is not expanded when used without parentheses.
  */
-#define MYSTIC_NODISCARD(...) \
-    MYSTIC_NODISCARD_MACRO_DISPATCHER(__VA_ARGS__, MYSTIC_NODISCARD_WITH_MSG, MYSTIC_NODISCARD_NO_MSG, )()(__VA_ARGS__)
-
+#define MYSTIC_NODISCARD MYSTIC_NODISCARD_NO_MSG
@@ -0,0 +1,195 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/barrier.hpp
+ * @file barrier.hpp
+ * @brief Defines reusable sense-reversing tree barrier.
+ *
+ * @details
+ * This header provides `barrier`, a reusable phase barrier for a fixed
+ * set of participants, usable from C++17.
+ *
+ * Arrivals are combined in a tree with fan-in 4, every node on its own
+ * cache line, so at most 4 threads contend on any counter, however many
+ * participants there are. The last arrival at a node resets it and moves
+ * up, the last arrival at the root flips the phase word (the sense), which
+ * releases everyone. Since arrivals are routed by leaf, every participant
+ * passes its own index in [0, participants).
+ *
+ * How waiting threads wait is picked by the `WaitStrategy` template
+ * parameter (see `wait_strategy.hpp`), `barrier` uses `spin_then_park`.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/barrier.hpp"
+ *
+ * mystic::concurrency::barrier phase(worker_count);
+ *
+ * // Worker `index`
+ * for (auto& step : steps) {
+ *     step.run(index);
+ *     phase.arrive_and_wait(index);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Reusable tree barrier, blocking through a wait strategy.
+ *
+ * @tparam WaitStrategy How waiting threads wait.
+ */
+template <typename WaitStrategy>
+class basic_barrier {
+public:
+    /// Number of children (or participants) combined per tree node.
+    static constexpr ::mystic::types::size_t kFanIn = 4;
+
+    /**
+     * @brief Constructs for the given number of participants (at least 1).
+     */
+    explicit basic_barrier(::mystic::types::size_t participants)
+        : participants_(participants != 0 ? participants : 1) {
+        // Count the nodes, level by level, leaves first.
+        ::mystic::types::size_t count = 0;
+        for (::mystic::types::size_t width = participants_;;) {
+            width = (width + kFanIn - 1) / kFanIn;
+            count += width;
+            if (width == 1) {
+                break;
+            }
+        }
+        nodes_ = std::make_unique<Node[]>(count);
+
+        // Link every level to the next, each node expects its child count.
+        ::mystic::types::size_t start = 0;
+        ::mystic::types::size_t children = participants_;
+        for (;;) {
+            const ::mystic::types::size_t width = (children + kFanIn - 1) / kFanIn;
+            for (::mystic::types::size_t index = 0; index < width; ++index) {
+                Node& node = nodes_[start + index];
+                const ::mystic::types::size_t remaining = children - index * kFanIn;
+                node.expected = static_cast<::mystic::types::uint32_t>(
+                    remaining < kFanIn ? remaining : kFanIn);
+                node.count.store(node.expected, std::memory_order_relaxed);
+                node.parent = width == 1 ? kNoParent : start + width + index / kFanIn;
+            }
+            if (width == 1) {
+                break;
+            }
+            start += width;
+            children = width;
+        }
+    }
+
+    basic_barrier(const basic_barrier&) = delete;
+    basic_barrier& operator=(const basic_barrier&) = delete;
+
+    /**
+     * @brief Returns the number of participants.
+     */
+    ::mystic::types::size_t participants() const noexcept { return participants_; }
+
+    /**
+     * @brief Arrives at the barrier, and blocks until every participant
+     * arrived in this phase.
+     *
+     * @param participant The caller's index, in [0, participants()),
+     *                    unique among the threads of a phase.
+     */
+    void arrive_and_wait(::mystic::types::size_t participant) noexcept {
+        // The phase cannot move before this arrival, so reading it first
+        // gives the sense to wait on.
+        const ::mystic::types::uint32_t phase = phase_.load(std::memory_order_acquire);
+
+        ::mystic::types::size_t index = participant / kFanIn;
+        for (;;) {
+            Node& node = nodes_[index];
+            if (node.count.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+                break;
+            }
+
+            // Last arrival: reset for the next phase, published by the flip.
+            node.count.store(node.expected, std::memory_order_relaxed);
+            if (node.parent == kNoParent) {
+                phase_.store(phase + 1, std::memory_order_release);
+                WaitStrategy::notify_all(phase_);
+                return;
+            }
+            index = node.parent;
+        }
+
+        while (phase_.load(std::memory_order_acquire) == phase) {
+            WaitStrategy::wait(phase_, phase);
+        }
+    }
+
+private:
+    static constexpr ::mystic::types::size_t kNoParent = static_cast<::mystic::types::size_t>(-1);
+
+    /**
+     * @brief One tree node, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Node {
+        std::atomic<::mystic::types::uint32_t> count{0};
+        ::mystic::types::uint32_t expected = 0;
+        ::mystic::types::size_t parent = 0;
+    }; // struct Node
+
+    /// Number of participants
+    ::mystic::types::size_t participants_;
+
+    /// Tree nodes, leaves first, the root is last
+    std::unique_ptr<Node[]> nodes_;
+
+    /// Phase counter, its change is the sense flip
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) std::atomic<::mystic::types::uint32_t> phase_{0};
+
+}; // class basic_barrier
+
+/**
+ * @brief Tree barrier, whose waiting threads spin, then park.
+ */
+using barrier = basic_barrier<spin_then_park>;
+
+} // namespace concurrency
+} // namespace mystic
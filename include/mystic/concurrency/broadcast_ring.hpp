@@ -0,0 +1,447 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/broadcast_ring.hpp
+ * @file broadcast_ring.hpp
+ * @brief Defines single-writer multicast ring buffer (disruptor).
+ *
+ * @details
+ * This header provides `broadcast_ring<T>`, a ring buffer written by one
+ * producer and read by any number of consumers, each seeing every item.
+ * Items are written once, in place, and never copied per consumer.
+ *
+ * Every party owns a cursor, a sequence number on its own cache line:
+ *
+ * 1. The producer claims slots, fills them, and publishes, advancing its
+ *    cursor. It never overwrites a slot some consumer has not released.
+ * 2. A consumer reads every item up to the lowest cursor it depends on,
+ *    the producer's, plus those of the consumers passed at registration
+ *    (pipeline barriers), in a single batch, then releases the batch.
+ *
+ * Sequences are 32-bit and compared wrap-around safe, so the ring runs
+ * forever, and cursors can be waited on through the `WaitStrategy`
+ * template parameter (see `wait_strategy.hpp`).
+ *
+ * Consumers must be added before the producer starts publishing. A
+ * consumer's wait also takes a cancellation token and a deadline, so it
+ * can be stopped while the producer is idle.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/broadcast_ring.hpp"
+ *
+ * mystic::concurrency::broadcast_ring<LogRecord> ring(4096);
+ *
+ * auto& file_sink = ring.add_consumer();
+ * auto& network_sink = ring.add_consumer();
+ * auto& metrics = ring.add_consumer({&file_sink}); // only sees written records
+ *
+ * // Producer
+ * ring.push(record);
+ *
+ * // Consumer thread
+ * file_sink.consume([](const LogRecord& record, uint32_t) { write(record); });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <initializer_list>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/async/cancellation.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/status/status_or.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Single-writer ring, every item is seen by every consumer.
+ *
+ * @tparam T The item type, default constructible and assignable.
+ * @tparam WaitStrategy How the producer and consumers wait on each other.
+ */
+template <typename T, typename WaitStrategy = spin_then_park>
+class broadcast_ring {
+    using sequence_type = ::mystic::types::uint32_t;
+
+    /**
+     * @brief A sequence number, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Cursor {
+        /// Next sequence the owner will produce or consume
+        std::atomic<sequence_type> sequence{0};
+
+        /// Number of threads waiting for sequence to move
+        mutable std::atomic<::mystic::types::uint32_t> waiters{0};
+    }; // struct Cursor
+
+public:
+    using value_type = T;
+
+    /// Largest capacity, keeps every distance below 2^31.
+    static constexpr ::mystic::types::size_t kMaxCapacity = ::mystic::types::size_t{1} << 30;
+
+    /**
+     * @brief A registered reader, with its own cursor.
+     */
+    class consumer {
+    public:
+        consumer(const consumer&) = delete;
+        consumer& operator=(const consumer&) = delete;
+
+        /**
+         * @brief Returns the number of items ready to read, without waiting.
+         */
+        MYSTIC_NODISCARD sequence_type available() const noexcept {
+            return limit() - cursor_.sequence.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Waits until at least one item is ready.
+         *
+         * @returns The number of items ready to read.
+         */
+        sequence_type wait_available() noexcept {
+            const sequence_type position = cursor_.sequence.load(std::memory_order_relaxed);
+            for (;;) {
+                const Cursor* blocker = nullptr;
+                const sequence_type ready = limit(&blocker) - position;
+                if (ready != 0) {
+                    return ready;
+                }
+                waitMove(*blocker, position);
+            }
+        }
+
+        /**
+         * @brief Waits until at least one item is ready, until token is
+         * cancelled or until passes.
+         *
+         * @returns The number of items ready to read, or
+         * StatusCode::CANCELLED or StatusCode::DEADLINE_EXCEEDED.
+         */
+        status::StatusOr<sequence_type> wait_available(
+            const async::cancellation_token& token,
+            const async::deadline& until = async::deadline::never()) noexcept {
+            const sequence_type position = cursor_.sequence.load(std::memory_order_relaxed);
+            for (;;) {
+                const Cursor* blocker = nullptr;
+                const sequence_type ready = limit(&blocker) - position;
+                if (ready != 0) {
+                    return ready;
+                }
+                const status::StatusCode code = async::check(token, until);
+                if (code != status::StatusCode::OK) {
+                    return code;
+                }
+                waitMoveUntil(*blocker, position, token, until);
+            }
+        }
+
+        /**
+         * @brief Returns the item at sequence, which must be in
+         * [position(), position() + available()).
+         */
+        const T& operator[](sequence_type sequence) const noexcept {
+            return ring_->slots_[sequence & ring_->mask_];
+        }
+
+        /**
+         * @brief Returns the next sequence this consumer reads.
+         */
+        sequence_type position() const noexcept {
+            return cursor_.sequence.load(std::memory_order_relaxed);
+        }
+
+        /**
+         * @brief Releases count items, the producer and dependents may proceed.
+         */
+        void release(sequence_type count) noexcept {
+            advance(cursor_, cursor_.sequence.load(std::memory_order_relaxed) + count);
+        }
+
+        /**
+         * @brief Waits for items, then calls fn(item, sequence) on the whole
+         * ready batch, and releases it.
+         *
+         * @returns The batch size.
+         */
+        template <typename Function>
+        sequence_type consume(Function&& fn) {
+            return consumeBatch(wait_available(), fn);
+        }
+
+        /**
+         * @brief Like consume(), but returns 0 instead of waiting.
+         */
+        template <typename Function>
+        sequence_type try_consume(Function&& fn) {
+            return consumeBatch(available(), fn);
+        }
+
+    private:
+        friend class broadcast_ring;
+
+        consumer(broadcast_ring* ring, std::vector<const Cursor*> dependencies)
+            : ring_(ring), dependencies_(std::move(dependencies)) {}
+
+        /**
+         * @brief Returns the lowest cursor this consumer depends on.
+         */
+        sequence_type limit(const Cursor** blocker = nullptr) const noexcept {
+            const sequence_type position = cursor_.sequence.load(std::memory_order_relaxed);
+            sequence_type lowest = 0;
+            bool first = true;
+            for (const Cursor* dependency : dependencies_) {
+                const sequence_type ahead =
+                    dependency->sequence.load(std::memory_order_acquire) - position;
+                if (first || ahead < lowest) {
+                    lowest = ahead;
+                    first = false;
+                    if (blocker != nullptr) {
+                        *blocker = dependency;
+                    }
+                }
+            }
+            return position + lowest;
+        }
+
+        template <typename Function>
+        sequence_type consumeBatch(sequence_type count, Function& fn) {
+            const sequence_type position = cursor_.sequence.load(std::memory_order_relaxed);
+            for (sequence_type offset = 0; offset < count; ++offset) {
+                fn((*this)[position + offset], position + offset);
+            }
+            if (count != 0) {
+                advance(cursor_, position + count);
+            }
+            return count;
+        }
+
+        /// Owning ring
+        broadcast_ring* ring_;
+
+        /// Producer cursor, then the cursors of consumers this one follows
+        std::vector<const Cursor*> dependencies_;
+
+        /// Next sequence to read
+        Cursor cursor_;
+
+    }; // class consumer
+
+    /**
+     * @brief Constructs a ring of at least capacity slots (rounded up to a
+     * power of two, at most kMaxCapacity).
+     */
+    explicit broadcast_ring(::mystic::types::size_t capacity)
+        : mask_(roundUp(capacity) - 1), slots_(std::make_unique<T[]>(mask_ + 1)) {}
+
+    broadcast_ring(const broadcast_ring&) = delete;
+    broadcast_ring& operator=(const broadcast_ring&) = delete;
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    ::mystic::types::size_t capacity() const noexcept { return mask_ + 1; }
+
+    /**
+     * @brief Registers a consumer, which only reads items every consumer in
+     * dependencies released. Must happen before publishing starts.
+     */
+    consumer& add_consumer(std::initializer_list<const consumer*> dependencies = {}) {
+        std::vector<const Cursor*> cursors;
+        cursors.reserve(dependencies.size() + 1);
+        cursors.push_back(&published_);
+        for (const consumer* dependency : dependencies) {
+            cursors.push_back(&dependency->cursor_);
+        }
+        consumers_.push_back(std::unique_ptr<consumer>(new consumer(this, std::move(cursors))));
+        consumer& added = *consumers_.back();
+        added.cursor_.sequence.store(published_.sequence.load(std::memory_order_relaxed),
+                                     std::memory_order_relaxed);
+        return added;
+    }
+
+    /**
+     * @brief Claims count slots (at most capacity()), waiting until every
+     * consumer released them. Producer only.
+     *
+     * @returns The sequence of the first claimed slot.
+     */
+    sequence_type claim(sequence_type count = 1) noexcept {
+        const sequence_type first = claimed_;
+        const sequence_type end = first + count;
+        while (static_cast<::mystic::types::size_t>(end - gate_) > mask_ + 1) {
+            const Cursor* slowest = refreshGate();
+            if (slowest == nullptr ||
+                static_cast<::mystic::types::size_t>(end - gate_) <= mask_ + 1) {
+                break;
+            }
+            waitMove(*slowest, gate_);
+        }
+        claimed_ = end;
+        return first;
+    }
+
+    /**
+     * @brief Returns the claimed slot at sequence. Producer only.
+     */
+    T& operator[](sequence_type sequence) noexcept { return slots_[sequence & mask_]; }
+
+    /**
+     * @brief Publishes the next count claimed slots to consumers. Producer only.
+     */
+    void publish(sequence_type count = 1) noexcept {
+        advance(published_, published_.sequence.load(std::memory_order_relaxed) + count);
+    }
+
+    /**
+     * @brief Claims, writes and publishes one item. Producer only.
+     */
+    template <typename U>
+    void push(U&& value) {
+        const sequence_type sequence = claim(1);
+        slots_[sequence & mask_] = static_cast<U&&>(value);
+        publish(1);
+    }
+
+private:
+    static ::mystic::types::size_t roundUp(::mystic::types::size_t capacity) noexcept {
+        ::mystic::types::size_t result = 1;
+        while (result < capacity && result < kMaxCapacity) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /**
+     * @brief Moves cursor to value, and wakes threads waiting on it.
+     */
+    static void advance(Cursor& cursor, sequence_type value) noexcept {
+        if constexpr (WaitStrategy::kMayPark) {
+            // Sequentially consistent against waitMove(), so a waiter
+            // either sees the new value, or is seen and woken.
+            cursor.sequence.store(value, std::memory_order_seq_cst);
+            if (MYSTIC_UNLIKELY(cursor.waiters.load(std::memory_order_seq_cst) != 0)) {
+                WaitStrategy::notify_all(cursor.sequence);
+            }
+        } else {
+            cursor.sequence.store(value, std::memory_order_release);
+        }
+    }
+
+    /**
+     * @brief Waits until cursor no longer holds observed.
+     */
+    static void waitMove(const Cursor& cursor, sequence_type observed) noexcept {
+        if constexpr (WaitStrategy::kMayPark) {
+            cursor.waiters.fetch_add(1, std::memory_order_seq_cst);
+            if (cursor.sequence.load(std::memory_order_seq_cst) == observed) {
+                WaitStrategy::wait(cursor.sequence, observed);
+            }
+            cursor.waiters.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            WaitStrategy::wait(cursor.sequence, observed);
+        }
+    }
+
+    /**
+     * @brief Waits until cursor no longer holds observed, until token is
+     * cancelled or until passes.
+     */
+    static void waitMoveUntil(const Cursor& cursor, sequence_type observed,
+                              const async::cancellation_token& token,
+                              const async::deadline& until) noexcept {
+        async::cancellation_callback wake(
+            token, [&cursor] { WaitStrategy::notify_all(cursor.sequence); });
+        const auto interrupted = [&token] { return token.is_cancellation_requested(); };
+        if constexpr (WaitStrategy::kMayPark) {
+            cursor.waiters.fetch_add(1, std::memory_order_seq_cst);
+            if (cursor.sequence.load(std::memory_order_seq_cst) == observed) {
+                WaitStrategy::wait_until(cursor.sequence, observed, until.when(), interrupted);
+            }
+            cursor.waiters.fetch_sub(1, std::memory_order_relaxed);
+        } else {
+            WaitStrategy::wait_until(cursor.sequence, observed, until.when(), interrupted);
+        }
+    }
+
+    /**
+     * @brief Sets gate_ to the lowest consumer cursor.
+     *
+     * @returns The cursor of the slowest consumer, or nullptr if there is
+     * no consumer (nothing gates the producer).
+     */
+    const Cursor* refreshGate() noexcept {
+        const Cursor* slowest = nullptr;
+        sequence_type largest_lag = 0;
+        for (const auto& reader : consumers_) {
+            const sequence_type position =
+                reader->cursor_.sequence.load(std::memory_order_acquire);
+            const sequence_type lag = claimed_ - position;
+            if (slowest == nullptr || lag > largest_lag) {
+                largest_lag = lag;
+                slowest = &reader->cursor_;
+                gate_ = position;
+            }
+        }
+        return slowest;
+    }
+
+    /// Capacity - 1
+    ::mystic::types::size_t mask_;
+
+    /// Slots
+    std::unique_ptr<T[]> slots_;
+
+    /// Registered consumers
+    std::vector<std::unique_ptr<consumer>> consumers_;
+
+    /// Producer: end of the claimed range
+    sequence_type claimed_ = 0;
+
+    /// Producer: cached lowest consumer cursor
+    sequence_type gate_ = 0;
+
+    /// Producer cursor, next sequence to publish
+    Cursor published_;
+
+}; // class broadcast_ring
+
+} // namespace concurrency
+} // namespace mystic
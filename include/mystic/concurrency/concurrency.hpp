@@ -0,0 +1,45 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/concurrency.hpp
+ * @file concurrency.hpp
+ * @brief Barrel file for concurrency module.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/concurrency/barrier.hpp"
+#include "mystic/concurrency/broadcast_ring.hpp"
+#include "mystic/concurrency/condition_variable.hpp"
+#include "mystic/concurrency/cpu_relax.hpp"
+#include "mystic/concurrency/epoch.hpp"
+#include "mystic/concurrency/hazard_pointer.hpp"
+#include "mystic/concurrency/latch.hpp"
+#include "mystic/concurrency/mutex.hpp"
+#include "mystic/concurrency/parking_lot.hpp"
+#include "mystic/concurrency/per_cpu.hpp"
+#include "mystic/concurrency/rate_limiter.hpp"
+#include "mystic/concurrency/semaphore.hpp"
+#include "mystic/concurrency/seqlock.hpp"
+#include "mystic/concurrency/sharded_counter.hpp"
+#include "mystic/concurrency/shared_mutex_distributed.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/concurrency/word_lock.hpp"
@@ -0,0 +1,244 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/condition_variable.hpp
+ * @file condition_variable.hpp
+ * @brief Defines 1-byte parking condition variable.
+ *
+ * @details
+ * This header provides `condition_variable`, a 1-byte condition variable
+ * with the interface of `std::condition_variable_any`. It works with any
+ * lockable, including `mystic::concurrency::mutex`, and its waiters live
+ * in the parking lot. Notifying without waiters costs a single load.
+ * Predicate waits also take a cancellation token and a deadline.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/condition_variable.hpp"
+ * #include "mystic/concurrency/mutex.hpp"
+ *
+ * mystic::concurrency::mutex lock;
+ * mystic::concurrency::condition_variable ready;
+ *
+ * // Consumer
+ * std::unique_lock<mystic::concurrency::mutex> guard(lock);
+ * ready.wait(guard, [&] { return !queue.empty(); });
+ *
+ * // Producer
+ * { std::lock_guard<mystic::concurrency::mutex> guard(lock); queue.push(item); }
+ * ready.notify_one();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <type_traits>
+
+#include "mystic/async/cancellation.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/parking_lot.hpp"
+#include "mystic/status/status_code.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief 1-byte condition variable, parks on the parking lot.
+ */
+class condition_variable {
+public:
+    constexpr condition_variable() noexcept = default;
+    condition_variable(const condition_variable&) = delete;
+    condition_variable& operator=(const condition_variable&) = delete;
+
+    /**
+     * @brief Wakes at most one waiter.
+     */
+    void notify_one() noexcept {
+        if (!has_waiters_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        parking_lot::unpark_one(&has_waiters_, [this](parking_lot::unpark_result result) {
+            has_waiters_.store(result.may_have_more, std::memory_order_relaxed);
+        });
+    }
+
+    /**
+     * @brief Wakes every waiter.
+     */
+    void notify_all() noexcept {
+        if (!has_waiters_.load(std::memory_order_relaxed)) {
+            return;
+        }
+        has_waiters_.store(false, std::memory_order_relaxed);
+        parking_lot::unpark_all(&has_waiters_);
+    }
+
+    /**
+     * @brief Releases lock and waits for a notification, then re-acquires.
+     * May wake spuriously.
+     */
+    template <typename Lock>
+    void wait(Lock& lock) {
+        waitImpl(lock, nullptr);
+    }
+
+    /**
+     * @brief Waits until pred() holds.
+     */
+    template <typename Lock, typename Predicate>
+    void wait(Lock& lock, Predicate pred) {
+        while (!pred()) {
+            waitImpl(lock, nullptr);
+        }
+    }
+
+    /**
+     * @brief Waits for a notification, or until deadline.
+     */
+    template <typename Lock, typename Clock, typename Duration>
+    std::cv_status wait_until(Lock& lock,
+                              const std::chrono::time_point<Clock, Duration>& deadline) {
+        const parking_lot::clock::time_point steady_deadline = toSteady(deadline);
+        return waitImpl(lock, &steady_deadline) ? std::cv_status::no_timeout
+                                                : std::cv_status::timeout;
+    }
+
+    /**
+     * @brief Waits until pred() holds, or until deadline.
+     *
+     * @returns pred(), evaluated last.
+     */
+    template <typename Lock, typename Clock, typename Duration, typename Predicate>
+    bool wait_until(Lock& lock, const std::chrono::time_point<Clock, Duration>& deadline,
+                    Predicate pred) {
+        const parking_lot::clock::time_point steady_deadline = toSteady(deadline);
+        while (!pred()) {
+            if (!waitImpl(lock, &steady_deadline)) {
+                return pred();
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Waits for a notification, or until timeout elapses.
+     */
+    template <typename Lock, typename Rep, typename Period>
+    std::cv_status wait_for(Lock& lock, const std::chrono::duration<Rep, Period>& timeout) {
+        return wait_until(lock, parking_lot::clock::now() + timeout);
+    }
+
+    /**
+     * @brief Waits until pred() holds, or until timeout elapses.
+     */
+    template <typename Lock, typename Rep, typename Period, typename Predicate>
+    bool wait_for(Lock& lock, const std::chrono::duration<Rep, Period>& timeout,
+                  Predicate pred) {
+        return wait_until(lock, parking_lot::clock::now() + timeout, static_cast<Predicate&&>(pred));
+    }
+
+    /**
+     * @brief Waits until pred() holds, until token is cancelled or until passes.
+     *
+     * @returns StatusCode::OK once pred() holds, StatusCode::CANCELLED or
+     * StatusCode::DEADLINE_EXCEEDED if not. The lock is held on return.
+     */
+    template <typename Lock, typename Predicate>
+    status::StatusCode wait(Lock& lock, Predicate pred, const async::cancellation_token& token,
+                            const async::deadline& until = async::deadline::never()) {
+        async::cancellation_callback wake(
+            token, [this] { parking_lot::unpark_all(&has_waiters_); });
+        const parking_lot::clock::time_point deadline = until.when();
+        while (!pred()) {
+            if (token.is_cancellation_requested()) {
+                return status::StatusCode::CANCELLED;
+            }
+            // Validated under the bucket lock, which the cancellation
+            // callback takes too, so a cancel cannot slip in before sleeping.
+            const parking_lot::park_result result = parking_lot::park_until(
+                &has_waiters_,
+                [this, &token] {
+                    has_waiters_.store(true, std::memory_order_relaxed);
+                    return !token.is_cancellation_requested();
+                },
+                [&lock] { lock.unlock(); }, until.is_never() ? nullptr : &deadline);
+            if (result.unparked || result.timed_out) {
+                lock.lock();
+            }
+            if (result.timed_out) {
+                return pred() ? status::StatusCode::OK : status::StatusCode::DEADLINE_EXCEEDED;
+            }
+        }
+        return status::StatusCode::OK;
+    }
+
+private:
+    /**
+     * @returns False if the deadline passed.
+     */
+    template <typename Lock>
+    bool waitImpl(Lock& lock, const parking_lot::clock::time_point* deadline) {
+        // Enqueue before releasing lock, so a notify after the caller's
+        // state change cannot be missed.
+        const parking_lot::park_result result = parking_lot::park_until(
+            &has_waiters_,
+            [this] {
+                has_waiters_.store(true, std::memory_order_relaxed);
+                return true;
+            },
+            [&lock] { lock.unlock(); }, deadline);
+        lock.lock();
+        return !result.timed_out;
+    }
+
+    template <typename Clock, typename Duration>
+    static parking_lot::clock::time_point toSteady(
+        const std::chrono::time_point<Clock, Duration>& deadline) {
+        if constexpr (std::is_same_v<Clock, parking_lot::clock>) {
+            return std::chrono::time_point_cast<parking_lot::clock::duration>(deadline);
+        } else {
+            return parking_lot::clock::now() +
+                   std::chrono::duration_cast<parking_lot::clock::duration>(deadline -
+                                                                            Clock::now());
+        }
+    }
+
+    /// True while threads may be waiting
+    std::atomic<bool> has_waiters_{false};
+
+}; // class condition_variable
+
+static_assert(sizeof(condition_variable) == 1, "condition_variable must be 1 byte.");
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,81 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/cpu_relax.hpp
+ * @file cpu_relax.hpp
+ * @brief Defines spin-wait CPU hint.
+ *
+ * @details
+ * This header provides `cpu_relax()`, which tells the CPU the caller is
+ * spinning (`pause` on x86, `yield` on Arm). It lowers power, and frees
+ * pipeline resources for the sibling hyper-thread.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/cpu_relax.hpp"
+ *
+ * while (!ready.load(std::memory_order_acquire)) {
+ *     mystic::concurrency::cpu_relax();
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <immintrin.h>
+# endif
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Hints the CPU that the caller is in a spin-wait loop.
+ */
+MYSTIC_FORCEINLINE void cpu_relax() noexcept {
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+    _mm_pause();
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(_MSC_VER)
+    __yield();
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM32)
+    __asm__ __volatile__("yield" ::: "memory");
+#endif
+}
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,451 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/epoch.hpp
+ * @file epoch.hpp
+ * @brief Defines epoch-based memory reclamation.
+ *
+ * @details
+ * This header provides epoch-based reclamation (EBR) for lock-free data
+ * structures. Readers pin the current epoch for the duration of a critical
+ * section, writers retire unlinked nodes instead of freeing them, and a node
+ * is freed once the global epoch has advanced twice past its retirement,
+ * which proves no pinned reader can still reference it.
+ *
+ * 1. Every thread owns a cache-line padded record per domain, pinning is
+ *    a store and a fence on that record, with no shared writes.
+ * 2. Retired nodes go to per-thread deferred free lists (one per epoch),
+ *    and are reclaimed in batches once a list grows past a threshold.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/epoch.hpp"
+ *
+ * namespace epoch = mystic::concurrency::epoch;
+ *
+ * // Reader
+ * {
+ *     auto guard = epoch::pin();
+ *     Node* node = head.load(std::memory_order_acquire);
+ *     // ... node stays valid until guard is destroyed
+ * }
+ *
+ * // Writer, after unlinking node
+ * epoch::retire(node);
+ * @endcode
+ *
+ * @note
+ * A stalled reader holding a guard prevents the epoch from advancing,
+ * so garbage accumulates behind it. Prefer hazard pointers for
+ * long-running readers.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <utility>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @namespace mystic::concurrency::epoch
+ * @brief Epoch-based memory reclamation.
+ */
+namespace epoch {
+
+class guard;
+
+/**
+ * @brief Reclamation domain, owns the global epoch and per-thread records.
+ *
+ * @warning
+ * A domain must outlive every thread which pinned it, the default domain
+ * is never destroyed.
+ */
+class domain {
+public:
+    /// Number of retired nodes, per thread, which triggers reclamation.
+    static constexpr ::mystic::types::size_t kCollectThreshold = 64;
+
+    domain() noexcept = default;
+    domain(const domain&) = delete;
+    domain& operator=(const domain&) = delete;
+
+    /**
+     * @brief Frees every record and every pending node.
+     * No thread may be pinned, or retiring, at this point.
+     */
+    ~domain() {
+        Record* record = records_.load(std::memory_order_acquire);
+        while (record != nullptr) {
+            Record* next = record->next;
+            for (Bucket& bucket : record->buckets) {
+                bucket.reclaim();
+            }
+            delete record;
+            record = next;
+        }
+    }
+
+    /**
+     * @brief Pins the current epoch for the calling thread.
+     * Guards nest, only the outermost one publishes the pin.
+     */
+    MYSTIC_NODISCARD guard pin() noexcept;
+
+    /**
+     * @brief Defers deletion of ptr until no pinned reader can see it.
+     */
+    template <typename T>
+    void retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* erased) { delete static_cast<T*>(erased); });
+    }
+
+    /**
+     * @brief Defers deleter(ptr) until no pinned reader can see ptr.
+     */
+    void retire(void* ptr, void (*deleter)(void*)) {
+        Record& record = localRecord();
+
+        // Order the caller's unlink of ptr before reading the epoch, else
+        // ptr could be tagged with an epoch older than a reader still
+        // holding it (pairs with the fence in enter()).
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        const ::mystic::types::uint64_t current = epoch_.load(std::memory_order_relaxed);
+
+        Bucket& bucket = record.buckets[bucketIndex(current)];
+        if (bucket.epoch != current) {
+            // The bucket holds nodes from three epochs ago, which are safe.
+            // Relabel it first, deleters may retire into it.
+            record.retired -= bucket.nodes.size();
+            bucket.epoch = current;
+            bucket.reclaim();
+        }
+        bucket.nodes.push_back(Retired{ptr, deleter});
+
+        if (MYSTIC_UNLIKELY(++record.retired >= kCollectThreshold)) {
+            collect(record);
+        }
+    }
+
+    /**
+     * @brief Tries to advance the epoch, and reclaims the caller's safe nodes.
+     */
+    void collect() { collect(localRecord()); }
+
+    /**
+     * @brief Returns the current global epoch.
+     */
+    ::mystic::types::uint64_t current_epoch() const noexcept {
+        return epoch_.load(std::memory_order_relaxed);
+    }
+
+private:
+    friend class guard;
+
+    /// Low bit of a record state, set while the thread is pinned.
+    static constexpr ::mystic::types::uint64_t kPinned = 1;
+
+    /// Epochs advance in steps of two, keeping the low bit for kPinned.
+    static constexpr ::mystic::types::uint64_t kStep = 2;
+
+    /// Number of deferred free lists per record.
+    static constexpr ::mystic::types::size_t kBucketCount = 3;
+
+    /**
+     * @brief A retired node and its deleter.
+     */
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    }; // struct Retired
+
+    /**
+     * @brief Deferred free list of the nodes retired in one epoch.
+     */
+    struct Bucket {
+        ::mystic::types::uint64_t epoch = 0;
+        std::vector<Retired> nodes;
+
+        /**
+         * @brief Runs the deleters of the nodes. A deleter may retire
+         * more nodes, they land in a fresh list.
+         */
+        void reclaim() noexcept {
+            std::vector<Retired> pending;
+            pending.swap(nodes);
+            for (const Retired& node : pending) {
+                node.deleter(node.ptr);
+            }
+            if (nodes.empty()) {
+                // Keep the capacity for the next epoch.
+                pending.clear();
+                nodes.swap(pending);
+            }
+        }
+    }; // struct Bucket
+
+    /**
+     * @brief Per-thread record, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Record {
+        /// Pinned epoch | kPinned, or 0 when quiescent (shared)
+        std::atomic<::mystic::types::uint64_t> state{0};
+
+        /// Set while a thread owns the record (shared)
+        std::atomic<bool> in_use{true};
+
+        /// Next record, immutable once published
+        Record* next = nullptr;
+
+        /// Guard nesting depth (owner only)
+        ::mystic::types::uint32_t nesting = 0;
+
+        /// Number of pending nodes across buckets (owner only)
+        ::mystic::types::size_t retired = 0;
+
+        /// Deferred free lists (owner only)
+        Bucket buckets[kBucketCount];
+    }; // struct Record
+
+    /**
+     * @brief Thread-local cache of the records owned by a thread.
+     * Records are handed back (with their pending nodes) on thread exit.
+     */
+    struct ThreadRecords {
+        std::vector<std::pair<const domain*, Record*>> entries;
+
+        ~ThreadRecords() {
+            for (auto& entry : entries) {
+                entry.second->in_use.store(false, std::memory_order_release);
+            }
+        }
+    }; // struct ThreadRecords
+
+    static constexpr ::mystic::types::size_t bucketIndex(::mystic::types::uint64_t epoch) noexcept {
+        return static_cast<::mystic::types::size_t>((epoch / kStep) % kBucketCount);
+    }
+
+    /**
+     * @brief Returns the calling thread's record, acquiring one if needed.
+     */
+    Record& localRecord() {
+        thread_local ThreadRecords cache;
+        for (auto& entry : cache.entries) {
+            if (entry.first == this) {
+                return *entry.second;
+            }
+        }
+        Record* record = acquireRecord();
+        cache.entries.emplace_back(this, record);
+        return *record;
+    }
+
+    /**
+     * @brief Reuses a released record, or publishes a new one.
+     */
+    Record* acquireRecord() {
+        for (Record* record = records_.load(std::memory_order_acquire);
+             record != nullptr; record = record->next) {
+            bool expected = false;
+            if (!record->in_use.load(std::memory_order_relaxed) &&
+                record->in_use.compare_exchange_strong(expected, true,
+                                                       std::memory_order_acquire)) {
+                return record;
+            }
+        }
+
+        Record* record = new Record();
+        Record* head = records_.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while (!records_.compare_exchange_weak(head, record,
+                                                 std::memory_order_release,
+                                                 std::memory_order_relaxed));
+        return record;
+    }
+
+    void enter(Record& record) noexcept {
+        if (record.nesting++ != 0) {
+            return;
+        }
+        const ::mystic::types::uint64_t current = epoch_.load(std::memory_order_relaxed);
+        record.state.store(current | kPinned, std::memory_order_relaxed);
+
+        // Publish the pin before any load of the protected structure.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+    }
+
+    void leave(Record& record) noexcept {
+        if (--record.nesting != 0) {
+            return;
+        }
+        record.state.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @brief Advances the epoch if every pinned thread has observed it.
+     */
+    bool tryAdvance() noexcept {
+        ::mystic::types::uint64_t current = epoch_.load(std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        for (Record* record = records_.load(std::memory_order_acquire);
+             record != nullptr; record = record->next) {
+            const ::mystic::types::uint64_t state = record->state.load(std::memory_order_relaxed);
+            if ((state & kPinned) != 0 && (state & ~kPinned) != current) {
+                return false;
+            }
+        }
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return epoch_.compare_exchange_strong(current, current + kStep,
+                                              std::memory_order_release,
+                                              std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Batched reclamation of the record's safe buckets.
+     */
+    void collect(Record& record) noexcept {
+        tryAdvance();
+        const ::mystic::types::uint64_t current = epoch_.load(std::memory_order_acquire);
+        for (Bucket& bucket : record.buckets) {
+            // Nodes retired at epoch e are unreachable once the epoch is e + 2 steps.
+            if (!bucket.nodes.empty() && bucket.epoch + 2 * kStep <= current) {
+                record.retired -= bucket.nodes.size();
+                bucket.reclaim();
+            }
+        }
+    }
+
+    /// Global epoch, a multiple of kStep
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE)
+    std::atomic<::mystic::types::uint64_t> epoch_{kStep};
+
+    /// Lock-free list of every record, never shrinks
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE)
+    std::atomic<Record*> records_{nullptr};
+
+}; // class domain
+
+/**
+ * @brief RAII guard, keeps the pinned epoch until destroyed.
+ */
+class guard {
+public:
+    guard() noexcept = default;
+
+    guard(const guard&) = delete;
+    guard& operator=(const guard&) = delete;
+
+    guard(guard&& other) noexcept
+        : domain_(std::exchange(other.domain_, nullptr)),
+          record_(std::exchange(other.record_, nullptr)) {}
+
+    guard& operator=(guard&& other) noexcept {
+        if (this != &other) {
+            release();
+            domain_ = std::exchange(other.domain_, nullptr);
+            record_ = std::exchange(other.record_, nullptr);
+        }
+        return *this;
+    }
+
+    ~guard() { release(); }
+
+    /**
+     * @brief Unpins early, the guard becomes empty.
+     */
+    void release() noexcept {
+        if (record_ != nullptr) {
+            domain_->leave(*record_);
+            domain_ = nullptr;
+            record_ = nullptr;
+        }
+    }
+
+    /**
+     * @brief Returns true while the guard pins an epoch.
+     */
+    bool active() const noexcept { return record_ != nullptr; }
+
+private:
+    friend class domain;
+
+    guard(domain& owner, domain::Record& record) noexcept
+        : domain_(&owner), record_(&record) {
+        domain_->enter(*record_);
+    }
+
+    /// Pinned domain
+    domain* domain_ = nullptr;
+
+    /// Calling thread's record in domain_
+    domain::Record* record_ = nullptr;
+
+}; // class guard
+
+inline guard domain::pin() noexcept {
+    return guard{*this, localRecord()};
+}
+
+/**
+ * @brief Returns the process-wide default domain (never destroyed).
+ */
+inline domain& default_domain() noexcept {
+    static domain* instance = new domain();
+    return *instance;
+}
+
+/**
+ * @brief Pins the default domain.
+ */
+MYSTIC_NODISCARD inline guard pin() noexcept {
+    return default_domain().pin();
+}
+
+/**
+ * @brief Retires ptr into the default domain.
+ */
+template <typename T>
+void retire(T* ptr) {
+    default_domain().retire(ptr);
+}
+
+} // namespace epoch
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,455 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/hazard_pointer.hpp
+ * @file hazard_pointer.hpp
+ * @brief Defines hazard pointer memory reclamation.
+ *
+ * @details
+ * This header provides hazard pointers, a reclamation scheme where each
+ * reader publishes the exact pointers it is dereferencing. A retired node
+ * is freed as soon as no published hazard points at it, so a stalled
+ * reader only pins the few nodes it protects, and memory stays bounded
+ * (unlike epoch-based reclamation).
+ *
+ * 1. Hazard slots are recycled through a small per-thread cache, so
+ *    constructing a hazard_pointer is a few plain loads and stores.
+ * 2. Retired nodes are kept on a per-thread list, and scanned once it
+ *    grows past twice the number of slots (amortized O(1) per retire).
+ *
+ * The API follows C++26 `<hazard_pointer>`.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/hazard_pointer.hpp"
+ *
+ * namespace mc = mystic::concurrency;
+ *
+ * // Reader
+ * mc::hazard_pointer hp = mc::make_hazard_pointer();
+ * Config* config = hp.protect(current_config);
+ * // ... config stays valid until hp is reset, or destroyed
+ *
+ * // Writer
+ * Config* old = current_config.exchange(fresh);
+ * mc::hazard_pointer_retire(old);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+class hazard_pointer;
+
+/**
+ * @brief Reclamation domain, owns the hazard slots and orphaned nodes.
+ *
+ * @warning
+ * A domain must outlive every thread which used it, the default domain
+ * is never destroyed.
+ */
+class hazard_pointer_domain {
+public:
+    /// Minimum number of retired nodes, per thread, before a scan.
+    static constexpr ::mystic::types::size_t kScanThreshold = 64;
+
+    /// Number of free slots a thread keeps for reuse.
+    static constexpr ::mystic::types::size_t kSlotCacheSize = 8;
+
+    hazard_pointer_domain() noexcept = default;
+    hazard_pointer_domain(const hazard_pointer_domain&) = delete;
+    hazard_pointer_domain& operator=(const hazard_pointer_domain&) = delete;
+
+    /**
+     * @brief Frees every slot and every pending node.
+     * No thread may hold a hazard pointer, or retire, at this point.
+     */
+    ~hazard_pointer_domain() {
+        for (const Retired& node : orphans_) {
+            node.deleter(node.ptr);
+        }
+        Slot* slot = slots_.load(std::memory_order_acquire);
+        while (slot != nullptr) {
+            Slot* next = slot->next;
+            delete slot;
+            slot = next;
+        }
+    }
+
+    /**
+     * @brief Defers deletion of ptr until no hazard pointer protects it.
+     */
+    template <typename T>
+    void retire(T* ptr) {
+        retire(static_cast<void*>(ptr), [](void* erased) { delete static_cast<T*>(erased); });
+    }
+
+    /**
+     * @brief Defers deleter(ptr) until no hazard pointer protects ptr.
+     */
+    void retire(void* ptr, void (*deleter)(void*)) {
+        ThreadState& state = localState();
+        state.retired.push_back(Retired{ptr, deleter});
+
+        const ::mystic::types::size_t threshold = std::max(
+            kScanThreshold,
+            2 * static_cast<::mystic::types::size_t>(slot_count_.load(std::memory_order_relaxed)));
+        if (MYSTIC_UNLIKELY(state.retired.size() >= threshold)) {
+            scan(state);
+        }
+    }
+
+    /**
+     * @brief Frees every node (retired by the caller) which is not protected.
+     */
+    void reclaim() { scan(localState()); }
+
+private:
+    friend class hazard_pointer;
+    friend hazard_pointer make_hazard_pointer(hazard_pointer_domain& domain);
+
+    /**
+     * @brief A retired node and its deleter.
+     */
+    struct Retired {
+        void* ptr;
+        void (*deleter)(void*);
+    }; // struct Retired
+
+    /**
+     * @brief Hazard slot, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Slot {
+        /// Protected pointer (shared)
+        std::atomic<const void*> hazard{nullptr};
+
+        /// Set while a thread owns the slot (shared)
+        std::atomic<bool> in_use{true};
+
+        /// Next slot, immutable once published
+        Slot* next = nullptr;
+    }; // struct Slot
+
+    /**
+     * @brief State of one thread in one domain.
+     */
+    struct ThreadState {
+        hazard_pointer_domain* owner = nullptr;
+
+        /// Free slots kept for reuse
+        Slot* cache[kSlotCacheSize] = {};
+        ::mystic::types::size_t cached = 0;
+
+        /// Nodes retired by this thread
+        std::vector<Retired> retired;
+
+        /// Scratch buffer for published hazards
+        std::vector<const void*> hazards;
+
+        /**
+         * @brief Hands slots and pending nodes back to the domain.
+         */
+        ~ThreadState() {
+            for (::mystic::types::size_t index = 0; index < cached; ++index) {
+                cache[index]->in_use.store(false, std::memory_order_release);
+            }
+            if (!retired.empty()) {
+                std::lock_guard<std::mutex> lock(owner->orphans_mutex_);
+                owner->orphans_.insert(owner->orphans_.end(), retired.begin(), retired.end());
+                owner->orphan_count_hint_.store(
+                    static_cast<::mystic::types::uint32_t>(owner->orphans_.size()),
+                    std::memory_order_relaxed);
+            }
+        }
+    }; // struct ThreadState
+
+    /**
+     * @brief Thread-local list of a thread's per-domain states.
+     */
+    struct ThreadStates {
+        std::vector<ThreadState*> entries;
+
+        ~ThreadStates() {
+            for (ThreadState* state : entries) {
+                delete state;
+            }
+        }
+    }; // struct ThreadStates
+
+    ThreadState& localState() {
+        thread_local ThreadStates states;
+        for (ThreadState* state : states.entries) {
+            if (state->owner == this) {
+                return *state;
+            }
+        }
+        ThreadState* state = new ThreadState();
+        state->owner = this;
+        states.entries.push_back(state);
+        return *state;
+    }
+
+    /**
+     * @brief Takes a slot from the thread cache, the domain, or the heap.
+     */
+    Slot* acquireSlot() {
+        ThreadState& state = localState();
+        if (MYSTIC_LIKELY(state.cached != 0)) {
+            return state.cache[--state.cached];
+        }
+
+        for (Slot* slot = slots_.load(std::memory_order_acquire);
+             slot != nullptr; slot = slot->next) {
+            bool expected = false;
+            if (!slot->in_use.load(std::memory_order_relaxed) &&
+                slot->in_use.compare_exchange_strong(expected, true,
+                                                     std::memory_order_acquire)) {
+                return slot;
+            }
+        }
+
+        Slot* slot = new Slot();
+        Slot* head = slots_.load(std::memory_order_relaxed);
+        do {
+            slot->next = head;
+        } while (!slots_.compare_exchange_weak(head, slot,
+                                               std::memory_order_release,
+                                               std::memory_order_relaxed));
+        slot_count_.fetch_add(1, std::memory_order_relaxed);
+        return slot;
+    }
+
+    /**
+     * @brief Returns a cleared slot to the thread cache, or the domain.
+     */
+    void releaseSlot(Slot* slot) noexcept {
+        slot->hazard.store(nullptr, std::memory_order_release);
+        ThreadState& state = localState();
+        if (MYSTIC_LIKELY(state.cached < kSlotCacheSize)) {
+            state.cache[state.cached++] = slot;
+            return;
+        }
+        slot->in_use.store(false, std::memory_order_release);
+    }
+
+    /**
+     * @brief Frees every node of state (and adopted orphans) not protected.
+     */
+    void scan(ThreadState& state) {
+        if (orphan_count_hint_.load(std::memory_order_relaxed) != 0) {
+            std::lock_guard<std::mutex> lock(orphans_mutex_);
+            state.retired.insert(state.retired.end(), orphans_.begin(), orphans_.end());
+            orphans_.clear();
+            orphan_count_hint_.store(0, std::memory_order_relaxed);
+        }
+
+        // Order the unlinking of retired nodes before reading the hazards.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        state.hazards.clear();
+        for (Slot* slot = slots_.load(std::memory_order_acquire);
+             slot != nullptr; slot = slot->next) {
+            const void* hazard = slot->hazard.load(std::memory_order_acquire);
+            if (hazard != nullptr) {
+                state.hazards.push_back(hazard);
+            }
+        }
+        std::sort(state.hazards.begin(), state.hazards.end());
+
+        auto kept = std::partition(state.retired.begin(), state.retired.end(),
+            [&state](const Retired& node) {
+                return std::binary_search(state.hazards.begin(), state.hazards.end(),
+                                          static_cast<const void*>(node.ptr));
+            });
+
+        // Take the nodes out before running deleters, which may retire
+        // (and scan) again.
+        const std::vector<Retired> reclaimable(kept, state.retired.end());
+        state.retired.erase(kept, state.retired.end());
+        for (const Retired& node : reclaimable) {
+            node.deleter(node.ptr);
+        }
+    }
+
+    /// Lock-free list of every slot, never shrinks
+    std::atomic<Slot*> slots_{nullptr};
+
+    /// Number of slots in slots_
+    std::atomic<::mystic::types::uint32_t> slot_count_{0};
+
+    /// Nodes left behind by exited threads
+    std::mutex orphans_mutex_;
+    std::vector<Retired> orphans_;
+    std::atomic<::mystic::types::uint32_t> orphan_count_hint_{0};
+
+}; // class hazard_pointer_domain
+
+/**
+ * @brief Owns one hazard slot, and protects at most one pointer at a time.
+ */
+class hazard_pointer {
+public:
+    /**
+     * @brief Constructs an empty hazard pointer, owning no slot.
+     */
+    hazard_pointer() noexcept = default;
+
+    hazard_pointer(const hazard_pointer&) = delete;
+    hazard_pointer& operator=(const hazard_pointer&) = delete;
+
+    hazard_pointer(hazard_pointer&& other) noexcept
+        : domain_(std::exchange(other.domain_, nullptr)),
+          slot_(std::exchange(other.slot_, nullptr)) {}
+
+    hazard_pointer& operator=(hazard_pointer&& other) noexcept {
+        if (this != &other) {
+            release();
+            domain_ = std::exchange(other.domain_, nullptr);
+            slot_ = std::exchange(other.slot_, nullptr);
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Clears the protection, and returns the slot.
+     */
+    ~hazard_pointer() { release(); }
+
+    /**
+     * @brief Returns true if no slot is owned.
+     */
+    MYSTIC_NODISCARD bool empty() const noexcept { return slot_ == nullptr; }
+
+    /**
+     * @brief Loads src and protects the loaded pointer, retrying until stable.
+     */
+    template <typename T>
+    T* protect(const std::atomic<T*>& src) noexcept {
+        T* ptr = src.load(std::memory_order_relaxed);
+        while (!try_protect(ptr, src)) {
+        }
+        return ptr;
+    }
+
+    /**
+     * @brief Protects ptr if src still holds it, otherwise updates ptr with
+     * the current value of src and returns false.
+     */
+    template <typename T>
+    bool try_protect(T*& ptr, const std::atomic<T*>& src) noexcept {
+        T* expected = ptr;
+        reset_protection(expected);
+
+        // Publish the hazard before validating it.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        ptr = src.load(std::memory_order_acquire);
+        if (MYSTIC_UNLIKELY(ptr != expected)) {
+            reset_protection();
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Protects ptr, the caller guarantees it is not yet retired.
+     */
+    template <typename T>
+    void reset_protection(const T* ptr) noexcept {
+        slot_->hazard.store(static_cast<const void*>(ptr), std::memory_order_release);
+    }
+
+    /**
+     * @brief Clears the protection.
+     */
+    void reset_protection() noexcept {
+        slot_->hazard.store(nullptr, std::memory_order_release);
+    }
+
+private:
+    friend hazard_pointer make_hazard_pointer(hazard_pointer_domain& domain);
+
+    hazard_pointer(hazard_pointer_domain& domain, hazard_pointer_domain::Slot* slot) noexcept
+        : domain_(&domain), slot_(slot) {}
+
+    void release() noexcept {
+        if (slot_ != nullptr) {
+            domain_->releaseSlot(slot_);
+            domain_ = nullptr;
+            slot_ = nullptr;
+        }
+    }
+
+    /// Owning domain
+    hazard_pointer_domain* domain_ = nullptr;
+
+    /// Owned slot
+    hazard_pointer_domain::Slot* slot_ = nullptr;
+
+}; // class hazard_pointer
+
+/**
+ * @brief Returns the process-wide default domain (never destroyed).
+ */
+inline hazard_pointer_domain& hazard_pointer_default_domain() noexcept {
+    static hazard_pointer_domain* instance = new hazard_pointer_domain();
+    return *instance;
+}
+
+/**
+ * @brief Constructs a hazard pointer owning a slot of domain.
+ */
+MYSTIC_NODISCARD inline hazard_pointer make_hazard_pointer(
+    hazard_pointer_domain& domain = hazard_pointer_default_domain()) {
+    return hazard_pointer{domain, domain.acquireSlot()};
+}
+
+/**
+ * @brief Retires ptr into the default domain.
+ */
+template <typename T>
+void hazard_pointer_retire(T* ptr) {
+    hazard_pointer_default_domain().retire(ptr);
+}
+
+} // namespace concurrency
+} // namespace mystic
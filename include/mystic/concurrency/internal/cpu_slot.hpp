@@ -0,0 +1,196 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/internal/cpu_slot.hpp
+ * @file cpu_slot.hpp
+ * @brief Current CPU and thread slot lookup, and restartable sequences.
+ *
+ * @details
+ * Sharded data structures pick a slot by the CPU the caller runs on, or
+ * failing that, by the dense thread index (see `mystic::platform::thread`).
+ *
+ * On Linux with glibc 2.35 or newer, every thread is registered for
+ * restartable sequences (rseq), and the kernel keeps the current CPU in
+ * the thread's `struct rseq`, so reading it is a plain load. On x86-64 an
+ * rseq critical section also performs a per-CPU add without any atomic
+ * instruction: if the thread is preempted or migrated before the add
+ * commits, the kernel aborts it, and the caller retries.
+ *
+ * `MYSTIC_CONCURRENCY_HAS_RSEQ` is 1 where the CPU can be read from rseq,
+ * and `MYSTIC_CONCURRENCY_HAS_RSEQ_ADD` is 1 where the add is available.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <thread>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/platform/thread_registry.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <unistd.h>
+#endif
+
+#if !defined(MYSTIC_CONCURRENCY_HAS_RSEQ)
+# if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && (defined(__GNUC__) || defined(__clang__)) && \
+     defined(__has_include)
+#  if __has_include(<sys/rseq.h>)
+#   define MYSTIC_CONCURRENCY_HAS_RSEQ 1
+#  else
+#   define MYSTIC_CONCURRENCY_HAS_RSEQ 0
+#  endif
+# else
+#  define MYSTIC_CONCURRENCY_HAS_RSEQ 0
+# endif
+#endif
+
+#if !defined(MYSTIC_CONCURRENCY_HAS_RSEQ_ADD)
+# if MYSTIC_CONCURRENCY_HAS_RSEQ && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+#  define MYSTIC_CONCURRENCY_HAS_RSEQ_ADD 1
+# else
+#  define MYSTIC_CONCURRENCY_HAS_RSEQ_ADD 0
+# endif
+#endif
+
+#if MYSTIC_CONCURRENCY_HAS_RSEQ
+# include <sys/rseq.h>
+#endif
+
+/**
+ * @namespace mystic::concurrency::internal
+ * @brief Internal implementation details of concurrency.
+ *
+ * @details
+ * This namespace contains internal implementation details of concurrency.
+ * **It should not be used directly.**
+ */
+namespace mystic::concurrency::internal {
+
+/// Returned by currentCpu() when the CPU is unknown.
+inline constexpr ::mystic::types::uint32_t kUnknownCpu = 0xFFFFFFFFu;
+
+/**
+ * @brief Returns the calling thread's slot index, its dense thread index,
+ * so live threads spread over distinct slots.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::size_t threadSlotIndex() noexcept {
+    return ::mystic::platform::thread::index();
+}
+
+/**
+ * @brief Returns the number of CPUs which may ever come online.
+ */
+inline ::mystic::types::size_t possibleCpuCount() noexcept {
+    static const ::mystic::types::size_t count = [] {
+        ::mystic::types::size_t result = std::thread::hardware_concurrency();
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        const long configured = ::sysconf(_SC_NPROCESSORS_CONF);
+        if (configured > 0 && static_cast<::mystic::types::size_t>(configured) > result) {
+            result = static_cast<::mystic::types::size_t>(configured);
+        }
+#endif
+        return result != 0 ? result : 1;
+    }();
+    return count;
+}
+
+#if MYSTIC_CONCURRENCY_HAS_RSEQ
+
+/**
+ * @brief Returns the calling thread's rseq area, or nullptr if unregistered.
+ */
+MYSTIC_FORCEINLINE volatile struct rseq* rseqArea() noexcept {
+    if (MYSTIC_UNLIKELY(__rseq_size == 0)) {
+        return nullptr;
+    }
+    return reinterpret_cast<volatile struct rseq*>(
+        static_cast<char*>(__builtin_thread_pointer()) + __rseq_offset);
+}
+
+#endif
+
+/**
+ * @brief Returns the CPU the caller runs on, or kUnknownCpu.
+ * The answer may be stale as soon as it is returned.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::uint32_t currentCpu() noexcept {
+#if MYSTIC_CONCURRENCY_HAS_RSEQ
+    volatile struct rseq* area = rseqArea();
+    if (MYSTIC_LIKELY(area != nullptr)) {
+        // Negative (not registered) values read as huge, callers range check.
+        return area->cpu_id;
+    }
+#endif
+    return kUnknownCpu;
+}
+
+#if MYSTIC_CONCURRENCY_HAS_RSEQ_ADD
+
+/**
+ * @brief Adds value to *word, if the caller still runs on cpu when the add
+ * commits. Uses no atomic instruction, only the owner of cpu may write to
+ * word this way.
+ *
+ * @returns False if the sequence was aborted (preemption, migration or
+ * signal), the caller should re-read the CPU and retry.
+ */
+MYSTIC_FORCEINLINE bool rseqAdd(::mystic::types::uint64_t* word, ::mystic::types::uint64_t value,
+                                ::mystic::types::uint32_t cpu) noexcept {
+    // The critical section descriptor (struct rseq_cs) is emitted into
+    // __rseq_cs, the abort handler is preceded by the signature glibc
+    // registered (RSEQ_SIG).
+    __asm__ __volatile__ goto(
+        ".pushsection __rseq_cs, \"aw\"\n\t"
+        ".balign 32\n\t"
+        "3:\n\t"
+        ".long 0x0, 0x0\n\t"
+        ".quad 1f, (2f - 1f), 4f\n\t"
+        ".popsection\n\t"
+        "leaq 3b(%%rip), %%rax\n\t"
+        "movq %%rax, %%fs:8(%[rseq_offset])\n\t"
+        "1:\n\t"
+        "cmpl %[cpu], %%fs:4(%[rseq_offset])\n\t"
+        "jnz %l[aborted]\n\t"
+        "addq %[value], %[word]\n\t"
+        "2:\n\t"
+        ".pushsection __rseq_failure, \"ax\"\n\t"
+        ".byte 0x0f, 0xb9, 0x3d\n\t"
+        ".long 0x53053053\n\t"
+        "4:\n\t"
+        "jmp %l[aborted]\n\t"
+        ".popsection\n\t"
+        :
+        : [cpu] "r"(cpu), [rseq_offset] "r"(__rseq_offset), [word] "m"(*word),
+          [value] "er"(value)
+        : "memory", "cc", "rax"
+        : aborted);
+    return true;
+aborted:
+    return false;
+}
+
+#endif
+
+} // namespace mystic::concurrency::internal
@@ -0,0 +1,160 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/latch.hpp
+ * @file latch.hpp
+ * @brief Defines single-use countdown latch.
+ *
+ * @details
+ * This header provides `latch`, a single-use countdown with the interface
+ * of `std::latch`, usable from C++17. Counting down is a single atomic
+ * operation, only the final count down wakes waiters. `wait()` also takes
+ * a cancellation token and a deadline.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/latch.hpp"
+ *
+ * mystic::concurrency::latch loaded(shard_count);
+ *
+ * // Every loader
+ * load(shard);
+ * loaded.count_down();
+ *
+ * // Coordinator
+ * loaded.wait();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+
+#include "mystic/async/cancellation.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Single-use countdown latch, blocking through a wait strategy.
+ *
+ * @tparam WaitStrategy How waiting threads wait.
+ */
+template <typename WaitStrategy>
+class basic_latch {
+public:
+    /**
+     * @brief Constructs with the number of expected count downs.
+     */
+    explicit basic_latch(::mystic::types::uint32_t expected) noexcept : count_(expected) {}
+
+    basic_latch(const basic_latch&) = delete;
+    basic_latch& operator=(const basic_latch&) = delete;
+
+    /**
+     * @brief Decrements the count by update, wakes waiters on reaching zero.
+     */
+    void count_down(::mystic::types::uint32_t update = 1) noexcept {
+        const ::mystic::types::uint32_t previous =
+            count_.fetch_sub(update, std::memory_order_acq_rel);
+        if (previous == update) {
+            WaitStrategy::notify_all(count_);
+        }
+    }
+
+    /**
+     * @brief Returns true if the count reached zero.
+     */
+    MYSTIC_NODISCARD bool try_wait() const noexcept {
+        return count_.load(std::memory_order_acquire) == 0;
+    }
+
+    /**
+     * @brief Blocks until the count reaches zero.
+     */
+    void wait() const noexcept {
+        ::mystic::types::uint32_t count = count_.load(std::memory_order_acquire);
+        while (count != 0) {
+            WaitStrategy::wait(count_, count);
+            count = count_.load(std::memory_order_acquire);
+        }
+    }
+
+    /**
+     * @brief Blocks until the count reaches zero, until token is cancelled
+     * or until passes.
+     *
+     * @returns StatusCode::OK once the count reached zero,
+     * StatusCode::CANCELLED or StatusCode::DEADLINE_EXCEEDED if not.
+     */
+    status::StatusCode wait(const async::cancellation_token& token,
+                            const async::deadline& until = async::deadline::never()) const noexcept {
+        ::mystic::types::uint32_t count = count_.load(std::memory_order_acquire);
+        if (count == 0) {
+            return status::StatusCode::OK;
+        }
+
+        async::cancellation_callback wake(token, [this] { WaitStrategy::notify_all(count_); });
+        const auto interrupted = [&token] { return token.is_cancellation_requested(); };
+        while (count != 0) {
+            const status::StatusCode code = async::check(token, until);
+            if (code != status::StatusCode::OK) {
+                return code;
+            }
+            WaitStrategy::wait_until(count_, count, until.when(), interrupted);
+            count = count_.load(std::memory_order_acquire);
+        }
+        return status::StatusCode::OK;
+    }
+
+    /**
+     * @brief Decrements the count by update, then blocks until it reaches zero.
+     */
+    void arrive_and_wait(::mystic::types::uint32_t update = 1) noexcept {
+        count_down(update);
+        wait();
+    }
+
+private:
+    /// Remaining count downs
+    std::atomic<::mystic::types::uint32_t> count_;
+
+}; // class basic_latch
+
+/**
+ * @brief Countdown latch, whose waiting threads spin, then park.
+ */
+using latch = basic_latch<spin_then_park>;
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,367 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/parking_lot.hpp
+ * @file parking_lot.hpp
+ * @brief Defines global hashed wait queue (parking lot).
+ *
+ * @details
+ * This header provides a parking lot, a single process-wide table of wait
+ * queues keyed by address. Any byte of memory can be waited on, so locks
+ * and condition variables built on it need only a couple of state bits
+ * (see `mutex` and `condition_variable`), instead of carrying their own
+ * wait queue.
+ *
+ * 1. `park()` enqueues the calling thread on an address, if a validation
+ *    callback (run under the bucket lock) agrees, then sleeps.
+ * 2. `unpark_one()` / `unpark_all()` dequeue and wake threads parked on
+ *    an address, `unpark_one()` runs a callback under the bucket lock so
+ *    the caller can update its state bits atomically with the dequeue.
+ *
+ * Every thread sleeps on its own parker, a word waited on through
+ * `mystic::platform::futex_wait()`.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/parking_lot.hpp"
+ *
+ * namespace parking_lot = mystic::concurrency::parking_lot;
+ *
+ * // Waiter
+ * parking_lot::park(&flag, [&] { return flag.load() == 0; }, [] {});
+ *
+ * // Waker
+ * flag.store(1);
+ * parking_lot::unpark_all(&flag);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/word_lock.hpp"
+#include "mystic/platform/futex.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::concurrency::internal {
+
+/**
+ * @brief Per-thread sleep primitive used by the parking lot.
+ */
+class ThreadParker {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Arms the parker, must happen before the thread is visible
+     * to unparkers.
+     */
+    void prepare() noexcept { parked_.store(1, std::memory_order_relaxed); }
+
+    /**
+     * @brief Sleeps until unparked, or deadline passes.
+     *
+     * @returns False if the deadline passed first.
+     */
+    bool waitUntil(const clock::time_point* deadline) noexcept {
+        while (parked_.load(std::memory_order_acquire) != 0) {
+            if (deadline == nullptr) {
+                ::mystic::platform::futex_wait(parked_, 1);
+            } else if (!::mystic::platform::futex_wait_until(parked_, 1, *deadline) &&
+                       parked_.load(std::memory_order_acquire) != 0) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Wakes the parked thread.
+     */
+    void unpark() noexcept {
+        // The thread may exit as soon as it sees the store, the wake only
+        // uses the address, never the memory behind it.
+        parked_.store(0, std::memory_order_release);
+        ::mystic::platform::futex_wake_one(parked_);
+    }
+
+private:
+    /// 1 while parked
+    std::atomic<::mystic::types::uint32_t> parked_{0};
+
+}; // class ThreadParker
+
+/**
+ * @brief Queue entry of a parked thread, one per thread.
+ */
+struct ParkedThread {
+    ThreadParker parker;
+    const void* address = nullptr;
+    ParkedThread* next = nullptr;
+}; // struct ParkedThread
+
+/**
+ * @brief One bucket of the parking lot, padded to its own cache line.
+ */
+struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ParkingBucket {
+    word_lock lock;
+    ParkedThread* head = nullptr;
+    ParkedThread* tail = nullptr;
+
+    /**
+     * @brief Unlinks entry, given its predecessor (or nullptr).
+     */
+    void unlink(ParkedThread* previous, ParkedThread* entry) noexcept {
+        if (previous != nullptr) {
+            previous->next = entry->next;
+        } else {
+            head = entry->next;
+        }
+        if (tail == entry) {
+            tail = previous;
+        }
+        entry->next = nullptr;
+    }
+}; // struct ParkingBucket
+
+/// Number of buckets in the parking lot (a power of two).
+inline constexpr ::mystic::types::size_t kParkingBucketCount = 512;
+
+/**
+ * @brief Returns the bucket of address.
+ */
+inline ParkingBucket& parkingBucket(const void* address) noexcept {
+    static ParkingBucket buckets[kParkingBucketCount];
+    const auto key = reinterpret_cast<::mystic::types::uintptr_t>(address);
+    const ::mystic::types::uint64_t hash =
+        static_cast<::mystic::types::uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+    return buckets[(hash >> 32) & (kParkingBucketCount - 1)];
+}
+
+/**
+ * @brief Returns the calling thread's queue entry.
+ */
+inline ParkedThread& parkedThread() noexcept {
+    thread_local ParkedThread self;
+    return self;
+}
+
+} // namespace mystic::concurrency::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @namespace mystic::concurrency::parking_lot
+ * @brief Global hashed wait queue.
+ */
+namespace parking_lot {
+
+using clock = std::chrono::steady_clock;
+
+/**
+ * @brief Result of a park.
+ */
+struct park_result {
+    /// True if woken by an unpark
+    bool unparked = false;
+
+    /// True if the deadline passed first
+    bool timed_out = false;
+}; // struct park_result
+
+/**
+ * @brief Result passed to the unpark_one() callback.
+ */
+struct unpark_result {
+    /// True if a thread was dequeued
+    bool did_unpark = false;
+
+    /// True if threads may remain parked on the address
+    bool may_have_more = false;
+}; // struct unpark_result
+
+/**
+ * @brief Parks the calling thread on address, until unparked or deadline.
+ *
+ * @param address The address to wait on.
+ * @param validate Called under the bucket lock, park is aborted if false.
+ * @param before_sleep Called after enqueueing, outside the bucket lock.
+ * @param deadline The deadline, or nullptr to wait forever.
+ */
+template <typename Validate, typename BeforeSleep>
+park_result park_until(const void* address, Validate&& validate,
+                       BeforeSleep&& before_sleep,
+                       const clock::time_point* deadline) {
+    internal::ParkedThread& self = internal::parkedThread();
+    internal::ParkingBucket& bucket = internal::parkingBucket(address);
+
+    {
+        std::lock_guard<word_lock> lock(bucket.lock);
+        if (!validate()) {
+            return park_result{};
+        }
+        self.address = address;
+        self.next = nullptr;
+        self.parker.prepare();
+        if (bucket.tail != nullptr) {
+            bucket.tail->next = &self;
+        } else {
+            bucket.head = &self;
+        }
+        bucket.tail = &self;
+    }
+
+    before_sleep();
+
+    if (MYSTIC_LIKELY(self.parker.waitUntil(deadline))) {
+        return park_result{true, false};
+    }
+
+    // Timed out, leave the queue, unless an unparker already dequeued us.
+    {
+        std::lock_guard<word_lock> lock(bucket.lock);
+        internal::ParkedThread* previous = nullptr;
+        for (internal::ParkedThread* entry = bucket.head; entry != nullptr;
+             previous = entry, entry = entry->next) {
+            if (entry == &self) {
+                bucket.unlink(previous, entry);
+                return park_result{false, true};
+            }
+        }
+    }
+
+    // Dequeued concurrently, the wakeup is imminent.
+    self.parker.waitUntil(nullptr);
+    return park_result{true, false};
+}
+
+/**
+ * @brief Parks the calling thread on address, until unparked.
+ */
+template <typename Validate, typename BeforeSleep>
+park_result park(const void* address, Validate&& validate, BeforeSleep&& before_sleep) {
+    return park_until(address, static_cast<Validate&&>(validate),
+                      static_cast<BeforeSleep&&>(before_sleep), nullptr);
+}
+
+/**
+ * @brief Wakes at most one thread parked on address.
+ *
+ * @param callback Called under the bucket lock with the unpark_result,
+ *                 before the dequeued thread is woken.
+ */
+template <typename Callback>
+unpark_result unpark_one(const void* address, Callback&& callback) {
+    internal::ParkingBucket& bucket = internal::parkingBucket(address);
+    internal::ParkedThread* woken = nullptr;
+    unpark_result result;
+
+    {
+        std::lock_guard<word_lock> lock(bucket.lock);
+        internal::ParkedThread* previous = nullptr;
+        internal::ParkedThread* entry = bucket.head;
+        while (entry != nullptr && entry->address != address) {
+            previous = entry;
+            entry = entry->next;
+        }
+        if (entry != nullptr) {
+            internal::ParkedThread* rest = entry->next;
+            bucket.unlink(previous, entry);
+            woken = entry;
+            result.did_unpark = true;
+            for (; rest != nullptr; rest = rest->next) {
+                if (rest->address == address) {
+                    result.may_have_more = true;
+                    break;
+                }
+            }
+        }
+        callback(result);
+    }
+
+    if (woken != nullptr) {
+        woken->parker.unpark();
+    }
+    return result;
+}
+
+/**
+ * @brief Wakes at most one thread parked on address.
+ */
+inline unpark_result unpark_one(const void* address) {
+    return unpark_one(address, [](unpark_result) {});
+}
+
+/**
+ * @brief Wakes every thread parked on address.
+ *
+ * @returns The number of woken threads.
+ */
+inline ::mystic::types::size_t unpark_all(const void* address) {
+    internal::ParkingBucket& bucket = internal::parkingBucket(address);
+    internal::ParkedThread* woken = nullptr;
+    ::mystic::types::size_t count = 0;
+
+    {
+        std::lock_guard<word_lock> lock(bucket.lock);
+        internal::ParkedThread* previous = nullptr;
+        internal::ParkedThread* entry = bucket.head;
+        while (entry != nullptr) {
+            internal::ParkedThread* next = entry->next;
+            if (entry->address == address) {
+                bucket.unlink(previous, entry);
+                entry->next = woken;
+                woken = entry;
+                ++count;
+            } else {
+                previous = entry;
+            }
+            entry = next;
+        }
+    }
+
+    while (woken != nullptr) {
+        // Read next before waking, the woken thread may reuse its entry.
+        internal::ParkedThread* next = woken->next;
+        woken->parker.unpark();
+        woken = next;
+    }
+    return count;
+}
+
+} // namespace parking_lot
+} // namespace concurrency
+} // namespace mystic
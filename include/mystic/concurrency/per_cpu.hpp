@@ -0,0 +1,158 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/per_cpu.hpp
+ * @file per_cpu.hpp
+ * @brief Defines per-CPU sharded storage.
+ *
+ * @details
+ * This header provides `per_cpu<T>`, one cache-line-padded T per CPU.
+ * `local()` returns the slot of the CPU the caller runs on, read from rseq
+ * on Linux (a plain load), or a per-thread slot where the CPU is unknown.
+ *
+ * The caller may migrate right after `local()` returns, and slots can be
+ * shared by threads, so T must tolerate concurrent access (atomics, or a
+ * lock). What sharding buys is that such access is almost never contended.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/per_cpu.hpp"
+ *
+ * mystic::concurrency::per_cpu<std::atomic<uint64_t>> bytes;
+ *
+ * // Hot path
+ * bytes.local().fetch_add(size, std::memory_order_relaxed);
+ *
+ * // Aggregation
+ * uint64_t total = 0;
+ * bytes.for_each([&](const std::atomic<uint64_t>& slot) { total += slot.load(); });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/internal/cpu_slot.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief One cache-line-padded T per CPU.
+ *
+ * @tparam T The slot type, default constructed.
+ */
+template <typename T>
+class per_cpu {
+public:
+    using value_type = T;
+
+    /**
+     * @brief Constructs one slot per possible CPU (rounded up to a power of two).
+     */
+    per_cpu() : slot_count_(roundUp(internal::possibleCpuCount())),
+                slots_(std::make_unique<Slot[]>(slot_count_)) {}
+
+    per_cpu(const per_cpu&) = delete;
+    per_cpu& operator=(const per_cpu&) = delete;
+
+    /**
+     * @brief Returns the slot of the caller's CPU (or thread).
+     */
+    MYSTIC_FORCEINLINE T& local() noexcept { return slots_[local_index()].value; }
+
+    /**
+     * @brief Returns the index of the caller's slot.
+     */
+    MYSTIC_FORCEINLINE ::mystic::types::size_t local_index() const noexcept {
+        const ::mystic::types::uint32_t cpu = internal::currentCpu();
+        if (MYSTIC_LIKELY(cpu < slot_count_)) {
+            return cpu;
+        }
+        return internal::threadSlotIndex() & (slot_count_ - 1);
+    }
+
+    /**
+     * @brief Returns the number of slots.
+     */
+    ::mystic::types::size_t size() const noexcept { return slot_count_; }
+
+    T& operator[](::mystic::types::size_t index) noexcept { return slots_[index].value; }
+    const T& operator[](::mystic::types::size_t index) const noexcept {
+        return slots_[index].value;
+    }
+
+    /**
+     * @brief Calls fn on every slot.
+     */
+    template <typename Function>
+    void for_each(Function&& fn) {
+        for (::mystic::types::size_t index = 0; index < slot_count_; ++index) {
+            fn(slots_[index].value);
+        }
+    }
+
+    template <typename Function>
+    void for_each(Function&& fn) const {
+        for (::mystic::types::size_t index = 0; index < slot_count_; ++index) {
+            fn(static_cast<const T&>(slots_[index].value));
+        }
+    }
+
+private:
+    /**
+     * @brief One slot, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) Slot {
+        T value{};
+    }; // struct Slot
+
+    static ::mystic::types::size_t roundUp(::mystic::types::size_t count) noexcept {
+        ::mystic::types::size_t result = 1;
+        while (result < count) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    /// Number of slots (a power of two)
+    ::mystic::types::size_t slot_count_;
+
+    /// Slots, indexed by CPU
+    std::unique_ptr<Slot[]> slots_;
+
+}; // class per_cpu
+
+} // namespace concurrency
+} // namespace mystic
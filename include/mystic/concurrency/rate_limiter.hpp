@@ -0,0 +1,371 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/rate_limiter.hpp
+ * @file rate_limiter.hpp
+ * @brief Defines lock-free token bucket rate limiters.
+ *
+ * @details
+ * This header provides `rate_limiter`, a token bucket whose whole state is
+ * one 64-bit atomic, and `sharded_rate_limiter`, which splits the rate
+ * over per-CPU buckets for call sites hit from every core.
+ *
+ * The state is the tick at which the bucket would hold no tokens, the
+ * tokens and the last refill folded into one number: the bucket holds
+ * `(now + burst * interval - state) / interval` tokens, and taking n moves
+ * the state n intervals ahead. Refill needs no separate write, a granted
+ * acquire is one compare-exchange, and a refused one only loads.
+ *
+ * Ticks come from `mystic::time::cycle_tick_source` by default, whose
+ * first use calibrates the counter (about 10 ms). `set_rate()` may be
+ * called at any time, e.g. by a feedback loop throttling adaptively: the
+ * rate and capacity are published together through a `seqlock`, so an
+ * acquire never pairs a new capacity with an old interval.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/rate_limiter.hpp"
+ *
+ * // At most 100 error logs per second, in bursts of up to 20
+ * mystic::concurrency::rate_limiter error_logs(100.0, 20);
+ *
+ * if (error_logs.try_acquire()) {
+ *     log_error(...);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/per_cpu.hpp"
+#include "mystic/concurrency/seqlock.hpp"
+#include "mystic/time/tick_source.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::concurrency::internal {
+
+/**
+ * @brief Token bucket kept as a single "empty at" tick.
+ */
+template <typename TickSource>
+class TokenBucket {
+public:
+    using tick_type = ::mystic::types::uint64_t;
+
+    TokenBucket() noexcept = default;
+
+    /**
+     * @brief Sets the refill rate and the capacity, keeping the tokens held
+     * (up to the new capacity). A rate which is not positive refuses every
+     * acquire.
+     */
+    void configure(double tokens_per_second, ::mystic::types::uint32_t burst) noexcept {
+        const ::mystic::types::uint32_t held = available();
+        tick_type interval = kUnlimited;
+        if (tokens_per_second > 0.0) {
+            const double ticks =
+                static_cast<double>(TickSource::frequency()) / tokens_per_second;
+            interval = ticks < 1.0 ? 1
+                       : ticks >= static_cast<double>(kUnlimited / (burst + 1ull))
+                           ? kUnlimited / (burst + 1ull)
+                           : static_cast<tick_type>(ticks);
+        }
+        if (tokens_per_second <= 0.0) {
+            burst = 0;
+        }
+        config_.store(Config{interval, burst});
+
+        const tick_type missing = held < burst ? burst - held : 0;
+        state_.store(TickSource::now() + missing * interval, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Fills the bucket up to its capacity.
+     */
+    void refill() noexcept { state_.store(0, std::memory_order_relaxed); }
+
+    /**
+     * @brief Takes between minimum and maximum tokens, as many as held.
+     *
+     * @returns The number of tokens taken, 0 if fewer than minimum are held.
+     */
+    MYSTIC_FORCEINLINE ::mystic::types::uint32_t acquire(
+        ::mystic::types::uint32_t minimum, ::mystic::types::uint32_t maximum) noexcept {
+        const Config config = config_.load();
+        const tick_type burst = config.burst;
+        if (MYSTIC_UNLIKELY(minimum > burst)) {
+            return 0;
+        }
+        const tick_type interval = config.interval;
+        const tick_type now = TickSource::now();
+        const tick_type full_at = now + burst * interval;
+
+        tick_type state = state_.load(std::memory_order_relaxed);
+        for (;;) {
+            const tick_type empty_at = state > now ? state : now;
+            const tick_type held = empty_at < full_at ? (full_at - empty_at) / interval : 0;
+            if (held < minimum) {
+                return 0;
+            }
+            const auto taken =
+                static_cast<::mystic::types::uint32_t>(held < maximum ? held : maximum);
+            if (state_.compare_exchange_weak(state, empty_at + taken * interval,
+                                             std::memory_order_relaxed,
+                                             std::memory_order_relaxed)) {
+                return taken;
+            }
+        }
+    }
+
+    /**
+     * @brief Returns the number of tokens held.
+     */
+    ::mystic::types::uint32_t available() const noexcept {
+        const Config config = config_.load();
+        const tick_type now = TickSource::now();
+        const tick_type full_at = now + config.burst * config.interval;
+        const tick_type state = state_.load(std::memory_order_relaxed);
+        const tick_type empty_at = state > now ? state : now;
+        return empty_at < full_at
+                   ? static_cast<::mystic::types::uint32_t>((full_at - empty_at) / config.interval)
+                   : 0;
+    }
+
+private:
+    /// Interval of a refused rate, large enough that nothing refills.
+    static constexpr tick_type kUnlimited = tick_type{1} << 62;
+
+    /**
+     * @brief Rate and capacity, replaced as a whole by configure().
+     * (burst + 1) * interval never exceeds kUnlimited.
+     */
+    struct Config {
+        /// Ticks per token
+        tick_type interval = kUnlimited;
+
+        /// Capacity, in tokens
+        ::mystic::types::uint32_t burst = 0;
+    }; // struct Config
+
+    /// Tick at which the bucket is empty, earlier ticks mean a full bucket
+    std::atomic<tick_type> state_{0};
+
+    seqlock<Config> config_;
+
+}; // class TokenBucket
+
+} // namespace mystic::concurrency::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Lock-free token bucket.
+ *
+ * @tparam TickSource The tick source, see `mystic::time::cycle_tick_source`.
+ */
+template <typename TickSource = time::cycle_tick_source>
+class basic_rate_limiter {
+public:
+    /**
+     * @brief Constructs a full bucket of burst tokens, refilled at
+     * tokens_per_second.
+     */
+    basic_rate_limiter(double tokens_per_second, ::mystic::types::uint32_t burst) noexcept {
+        bucket_.configure(tokens_per_second, burst);
+        bucket_.refill();
+    }
+
+    basic_rate_limiter(const basic_rate_limiter&) = delete;
+    basic_rate_limiter& operator=(const basic_rate_limiter&) = delete;
+
+    /**
+     * @brief Takes count tokens if held, all or nothing.
+     */
+    MYSTIC_NODISCARD MYSTIC_FORCEINLINE bool try_acquire(
+        ::mystic::types::uint32_t count = 1) noexcept {
+        return count == 0 || bucket_.acquire(count, count) == count;
+    }
+
+    /**
+     * @brief Takes up to count tokens, for a batch of events.
+     *
+     * @returns The number of tokens taken, the caller admits that many.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint32_t try_acquire_up_to(
+        ::mystic::types::uint32_t count) noexcept {
+        return count == 0 ? 0 : bucket_.acquire(1, count);
+    }
+
+    /**
+     * @brief Returns the number of tokens held (already stale).
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint32_t available() const noexcept {
+        return bucket_.available();
+    }
+
+    /**
+     * @brief Changes the rate and the capacity, tokens held are kept
+     * (up to the new capacity).
+     */
+    void set_rate(double tokens_per_second, ::mystic::types::uint32_t burst) noexcept {
+        bucket_.configure(tokens_per_second, burst);
+    }
+
+private:
+    internal::TokenBucket<TickSource> bucket_;
+
+}; // class basic_rate_limiter
+
+/**
+ * @brief Token bucket split into per-CPU buckets.
+ *
+ * The rate and capacity are split over one bucket per CPU, but never
+ * more buckets than burst tokens, so both totals hold. CPUs past the last
+ * bucket share the others. The cost is precision under skew: a caller
+ * whose bucket is empty probes a few neighbours before giving up.
+ *
+ * @tparam TickSource The tick source, see `mystic::time::cycle_tick_source`.
+ */
+template <typename TickSource = time::cycle_tick_source>
+class basic_sharded_rate_limiter {
+public:
+    /// Number of other buckets tried when the local one is empty.
+    static constexpr ::mystic::types::size_t kStealProbes = 3;
+
+    /**
+     * @brief Constructs full buckets holding burst tokens in total, refilled
+     * at tokens_per_second in total.
+     */
+    basic_sharded_rate_limiter(double tokens_per_second, ::mystic::types::uint32_t burst) {
+        set_rate(tokens_per_second, burst);
+        buckets_.for_each([](internal::TokenBucket<TickSource>& bucket) { bucket.refill(); });
+    }
+
+    basic_sharded_rate_limiter(const basic_sharded_rate_limiter&) = delete;
+    basic_sharded_rate_limiter& operator=(const basic_sharded_rate_limiter&) = delete;
+
+    /**
+     * @brief Takes count tokens from one bucket if held, all or nothing.
+     */
+    MYSTIC_NODISCARD MYSTIC_FORCEINLINE bool try_acquire(
+        ::mystic::types::uint32_t count = 1) noexcept {
+        return count == 0 || acquire(count, count) == count;
+    }
+
+    /**
+     * @brief Takes up to count tokens from one bucket, for a batch of events.
+     *
+     * @returns The number of tokens taken.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint32_t try_acquire_up_to(
+        ::mystic::types::uint32_t count) noexcept {
+        return count == 0 ? 0 : acquire(1, count);
+    }
+
+    /**
+     * @brief Returns the number of tokens held by every bucket (already stale).
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t available() const noexcept {
+        ::mystic::types::uint64_t total = 0;
+        buckets_.for_each([&total](const internal::TokenBucket<TickSource>& bucket) {
+            total += bucket.available();
+        });
+        return total;
+    }
+
+    /**
+     * @brief Changes the total rate and capacity.
+     */
+    void set_rate(double tokens_per_second, ::mystic::types::uint32_t burst) noexcept {
+        const ::mystic::types::size_t count = buckets_.size();
+        const ::mystic::types::size_t active = burst == 0 ? 1 : burst < count ? burst : count;
+        const auto share = static_cast<::mystic::types::uint32_t>(burst / active);
+        const ::mystic::types::size_t remainder = burst % active;
+        for (::mystic::types::size_t index = 0; index < count; ++index) {
+            if (index < active) {
+                buckets_[index].configure(tokens_per_second / static_cast<double>(active),
+                                          share + (index < remainder ? 1 : 0));
+            } else {
+                buckets_[index].configure(0.0, 0);
+            }
+        }
+        active_.store(active, std::memory_order_relaxed);
+    }
+
+private:
+    MYSTIC_FORCEINLINE ::mystic::types::uint32_t acquire(
+        ::mystic::types::uint32_t minimum, ::mystic::types::uint32_t maximum) noexcept {
+        const ::mystic::types::size_t active = active_.load(std::memory_order_relaxed);
+        ::mystic::types::size_t local = buckets_.local_index();
+        if (MYSTIC_UNLIKELY(local >= active)) {
+            local %= active;
+        }
+        const ::mystic::types::uint32_t taken = buckets_[local].acquire(minimum, maximum);
+        if (MYSTIC_LIKELY(taken != 0)) {
+            return taken;
+        }
+        return steal(local, active, minimum, maximum);
+    }
+
+    MYSTIC_NOINLINE ::mystic::types::uint32_t steal(::mystic::types::size_t local,
+                                                    ::mystic::types::size_t active,
+                                                    ::mystic::types::uint32_t minimum,
+                                                    ::mystic::types::uint32_t maximum) noexcept {
+        const ::mystic::types::size_t probes = kStealProbes < active ? kStealProbes : active - 1;
+        for (::mystic::types::size_t probe = 1; probe <= probes; ++probe) {
+            const ::mystic::types::uint32_t taken =
+                buckets_[(local + probe) % active].acquire(minimum, maximum);
+            if (taken != 0) {
+                return taken;
+            }
+        }
+        return 0;
+    }
+
+    /// Buckets, one per CPU
+    per_cpu<internal::TokenBucket<TickSource>> buckets_;
+
+    /// Number of buckets in use, the first ones
+    std::atomic<::mystic::types::size_t> active_{1};
+
+}; // class basic_sharded_rate_limiter
+
+/// Token bucket on the CPU cycle counter.
+using rate_limiter = basic_rate_limiter<>;
+
+/// Per-CPU token buckets on the CPU cycle counter.
+using sharded_rate_limiter = basic_sharded_rate_limiter<>;
+
+} // namespace concurrency
+} // namespace mystic
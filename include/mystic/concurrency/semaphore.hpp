@@ -0,0 +1,242 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/semaphore.hpp
+ * @file semaphore.hpp
+ * @brief Defines lightweight counting semaphore.
+ *
+ * @details
+ * This header provides `semaphore`, a counting semaphore with the
+ * interface of `std::counting_semaphore`, usable from C++17. An
+ * uncontended acquire or release is a single atomic operation in user
+ * space, threads only go to the kernel when they actually block, and
+ * release only wakes when someone is waiting.
+ *
+ * How blocked threads wait is picked by the `WaitStrategy` template
+ * parameter (see `wait_strategy.hpp`), `semaphore` uses `spin_then_park`.
+ * `acquire()` also takes a cancellation token and a deadline.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/semaphore.hpp"
+ *
+ * mystic::concurrency::semaphore slots(16);
+ *
+ * slots.acquire();
+ * submit(request);
+ * slots.release();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <type_traits>
+
+#include "mystic/async/cancellation.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Counting semaphore, blocking through a wait strategy.
+ *
+ * @tparam WaitStrategy How blocked threads wait.
+ */
+template <typename WaitStrategy>
+class basic_semaphore {
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @brief Constructs with initial available count.
+     */
+    explicit basic_semaphore(::mystic::types::uint32_t initial = 0) noexcept
+        : count_(initial) {}
+
+    basic_semaphore(const basic_semaphore&) = delete;
+    basic_semaphore& operator=(const basic_semaphore&) = delete;
+
+    /**
+     * @brief Returns the maximum count.
+     */
+    static constexpr ::mystic::types::uint32_t max() noexcept { return 0x7FFFFFFFu; }
+
+    /**
+     * @brief Decrements the count, fails if it is zero.
+     */
+    MYSTIC_NODISCARD bool try_acquire() noexcept {
+        ::mystic::types::uint32_t count = count_.load(std::memory_order_relaxed);
+        while (count != 0) {
+            if (count_.compare_exchange_weak(count, count - 1, std::memory_order_acquire,
+                                             std::memory_order_relaxed)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Decrements the count, blocks while it is zero.
+     */
+    void acquire() noexcept {
+        if (MYSTIC_LIKELY(try_acquire())) {
+            return;
+        }
+        acquireSlow(nullptr, [] { return false; });
+    }
+
+    /**
+     * @brief Decrements the count, blocks while it is zero, until token is
+     * cancelled or until passes.
+     *
+     * @returns StatusCode::OK if acquired, StatusCode::CANCELLED or
+     * StatusCode::DEADLINE_EXCEEDED if not.
+     */
+    status::StatusCode acquire(const async::cancellation_token& token,
+                               const async::deadline& until = async::deadline::never()) noexcept {
+        if (MYSTIC_LIKELY(try_acquire())) {
+            return status::StatusCode::OK;
+        }
+        const status::StatusCode code = async::check(token, until);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+
+        async::cancellation_callback wake(token, [this] { WaitStrategy::notify_all(count_); });
+        const clock::time_point deadline = until.when();
+        if (acquireSlow(&deadline, [&token] { return token.is_cancellation_requested(); })) {
+            return status::StatusCode::OK;
+        }
+        return token.is_cancellation_requested() ? status::StatusCode::CANCELLED
+                                                 : status::StatusCode::DEADLINE_EXCEEDED;
+    }
+
+    /**
+     * @brief Decrements the count, blocks while it is zero, until deadline.
+     *
+     * @returns False if the deadline passed.
+     */
+    template <typename Clock, typename Duration>
+    MYSTIC_NODISCARD bool try_acquire_until(
+        const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        if (MYSTIC_LIKELY(try_acquire())) {
+            return true;
+        }
+        const clock::time_point steady_deadline = toSteady(deadline);
+        return acquireSlow(&steady_deadline, [] { return false; });
+    }
+
+    /**
+     * @brief Decrements the count, blocks while it is zero, for timeout.
+     *
+     * @returns False if the timeout elapsed.
+     */
+    template <typename Rep, typename Period>
+    MYSTIC_NODISCARD bool try_acquire_for(
+        const std::chrono::duration<Rep, Period>& timeout) noexcept {
+        return try_acquire_until(clock::now() + timeout);
+    }
+
+    /**
+     * @brief Increments the count by update, and wakes blocked threads.
+     */
+    void release(::mystic::types::uint32_t update = 1) noexcept {
+        // Sequentially consistent on both sides: either a blocking thread
+        // sees the new count, or this release sees it waiting.
+        count_.fetch_add(update, std::memory_order_seq_cst);
+        if constexpr (WaitStrategy::kMayPark) {
+            if (MYSTIC_UNLIKELY(waiters_.load(std::memory_order_seq_cst) != 0)) {
+                if (update == 1) {
+                    WaitStrategy::notify_one(count_);
+                } else {
+                    WaitStrategy::notify_all(count_);
+                }
+            }
+        }
+    }
+
+private:
+    template <typename Interrupted>
+    MYSTIC_NOINLINE bool acquireSlow(const clock::time_point* deadline,
+                                     Interrupted&& interrupted) noexcept {
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        bool acquired = false;
+        for (;;) {
+            ::mystic::types::uint32_t count = count_.load(std::memory_order_seq_cst);
+            if (count != 0) {
+                if (count_.compare_exchange_weak(count, count - 1, std::memory_order_acquire,
+                                                 std::memory_order_relaxed)) {
+                    acquired = true;
+                    break;
+                }
+                continue;
+            }
+            if (deadline == nullptr) {
+                WaitStrategy::wait(count_, 0);
+            } else if (!WaitStrategy::wait_until(count_, 0, *deadline, interrupted)) {
+                acquired = try_acquire();
+                break;
+            }
+        }
+        waiters_.fetch_sub(1, std::memory_order_relaxed);
+        return acquired;
+    }
+
+    template <typename Clock, typename Duration>
+    static clock::time_point toSteady(
+        const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+        if constexpr (std::is_same_v<Clock, clock>) {
+            return std::chrono::time_point_cast<clock::duration>(deadline);
+        } else {
+            return clock::now() +
+                   std::chrono::duration_cast<clock::duration>(deadline - Clock::now());
+        }
+    }
+
+    /// Available count
+    std::atomic<::mystic::types::uint32_t> count_;
+
+    /// Number of threads in acquireSlow()
+    std::atomic<::mystic::types::uint32_t> waiters_{0};
+
+}; // class basic_semaphore
+
+/**
+ * @brief Counting semaphore, whose blocked threads spin, then park.
+ */
+using semaphore = basic_semaphore<spin_then_park>;
+
+} // namespace concurrency
+} // namespace mystic
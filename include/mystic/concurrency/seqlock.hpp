@@ -0,0 +1,234 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/seqlock.hpp
+ * @file seqlock.hpp
+ * @brief Defines sequence lock for tear-free snapshots.
+ *
+ * @details
+ * This header provides `seqlock<T>`, which publishes snapshots of a
+ * trivially copyable T. Readers never write shared memory, they copy the
+ * value and retry if a writer was active meanwhile. Writers never wait
+ * for readers (writer-preferred).
+ *
+ * The payload is stored as an array of atomic words accessed with relaxed
+ * ordering, and the sequence counter is ordered with fences, so the
+ * implementation is free of data races under the C++ memory model (see
+ * H. Boehm, "Can Seqlocks Get Along With Programming Language Memory
+ * Models?").
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/seqlock.hpp"
+ *
+ * struct Calibration { double ns_per_tick; uint64_t base_tick; };
+ *
+ * mystic::concurrency::seqlock<Calibration> calibration;
+ *
+ * // Writer (rare)
+ * calibration.store({0.3125, read_tick()});
+ *
+ * // Reader (every event)
+ * Calibration snapshot = calibration.load();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cstring>
+#include <thread>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Sequence lock guarding a trivially copyable T.
+ *
+ * @tparam T The guarded type.
+ */
+template <typename T>
+class alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) seqlock {
+    static_assert(std::is_trivially_copyable_v<T>,
+                  "seqlock<T> requires a trivially copyable T.");
+    static_assert(std::is_default_constructible_v<T>,
+                  "seqlock<T> requires a default constructible T.");
+
+    using word_type = ::mystic::types::uintptr_t;
+
+    /// Number of words needed to hold a T
+    static constexpr ::mystic::types::size_t kWordCount =
+        (sizeof(T) + sizeof(word_type) - 1) / sizeof(word_type);
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Constructs with a value-initialized T.
+     */
+    seqlock() noexcept : seqlock(T{}) {}
+
+    /**
+     * @brief Constructs with the given value.
+     */
+    explicit seqlock(const T& initial) noexcept { writeWords(initial); }
+
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    /**
+     * @brief Attempts a single read, fails if a writer was active.
+     * Wait-free, performs no shared writes.
+     *
+     * @returns True if out holds a consistent snapshot.
+     */
+    MYSTIC_NODISCARD bool try_load(T& out) const noexcept {
+        const word_type before = sequence_.load(std::memory_order_acquire);
+        if (MYSTIC_UNLIKELY((before & 1) != 0)) {
+            return false;
+        }
+
+        word_type buffer[kWordCount];
+        for (::mystic::types::size_t index = 0; index < kWordCount; ++index) {
+            buffer[index] = words_[index].load(std::memory_order_relaxed);
+        }
+
+        // Order the payload loads before re-reading the sequence.
+        std::atomic_thread_fence(std::memory_order_acquire);
+
+        const word_type after = sequence_.load(std::memory_order_relaxed);
+        if (MYSTIC_UNLIKELY(before != after)) {
+            return false;
+        }
+
+        std::memcpy(static_cast<void*>(&out), buffer, sizeof(T));
+        return true;
+    }
+
+    /**
+     * @brief Reads a consistent snapshot, retrying while writers are active.
+     */
+    MYSTIC_NODISCARD T load() const noexcept {
+        T value;
+        while (!try_load(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+    /**
+     * @brief Publishes a new value. Concurrent writers are serialized.
+     */
+    void store(const T& value) noexcept {
+        const word_type sequence = lockWriter();
+        writeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Applies fn to the current value, and publishes the result.
+     * Concurrent writers are serialized, so no update is lost.
+     */
+    template <typename Function>
+    void update(Function&& fn) noexcept(noexcept(fn(std::declval<T&>()))) {
+        const word_type sequence = lockWriter();
+
+        T value;
+        word_type buffer[kWordCount];
+        for (::mystic::types::size_t index = 0; index < kWordCount; ++index) {
+            buffer[index] = words_[index].load(std::memory_order_relaxed);
+        }
+        std::memcpy(static_cast<void*>(&value), buffer, sizeof(T));
+
+        fn(value);
+
+        writeWords(value);
+        sequence_.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * @brief Returns the number of completed writes.
+     */
+    word_type version() const noexcept {
+        return sequence_.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    /**
+     * @brief Makes the sequence odd, and returns its previous (even) value.
+     * Acquire pairs with the previous writer's release, for update().
+     */
+    word_type lockWriter() noexcept {
+        word_type sequence = sequence_.load(std::memory_order_relaxed);
+        for (;;) {
+            if (MYSTIC_LIKELY((sequence & 1) == 0) &&
+                sequence_.compare_exchange_weak(sequence, sequence + 1,
+                                                std::memory_order_acquire,
+                                                std::memory_order_relaxed)) {
+                break;
+            }
+            if ((sequence & 1) != 0) {
+                std::this_thread::yield();
+                sequence = sequence_.load(std::memory_order_relaxed);
+            }
+        }
+
+        // Order the odd sequence before any payload store.
+        std::atomic_thread_fence(std::memory_order_release);
+        return sequence;
+    }
+
+    /**
+     * @brief Stores value into the payload words.
+     */
+    void writeWords(const T& value) noexcept {
+        word_type buffer[kWordCount] = {};
+        std::memcpy(buffer, static_cast<const void*>(&value), sizeof(T));
+        for (::mystic::types::size_t index = 0; index < kWordCount; ++index) {
+            words_[index].store(buffer[index], std::memory_order_relaxed);
+        }
+    }
+
+    /// Sequence counter, odd while a writer is active
+    std::atomic<word_type> sequence_{0};
+
+    /// Payload
+    std::atomic<word_type> words_[kWordCount];
+
+}; // class seqlock
+
+} // namespace concurrency
+} // namespace mystic
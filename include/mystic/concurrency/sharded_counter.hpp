@@ -0,0 +1,145 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/sharded_counter.hpp
+ * @file sharded_counter.hpp
+ * @brief Defines per-CPU sharded counter.
+ *
+ * @details
+ * This header provides `sharded_counter`, a 64-bit counter for events
+ * counted from every core. Increments go to the caller's CPU slot, so
+ * cores never fight over a cache line, and `read()` sums the slots.
+ *
+ * 1. On x86-64 Linux with rseq (glibc 2.35+), an increment is a restartable
+ *    sequence, a plain `add` with no atomic instruction.
+ * 2. Elsewhere, it is a relaxed `fetch_add` on the CPU's slot, or on a
+ *    per-thread slot where the CPU is unknown.
+ *
+ * `read()` is not a snapshot, increments racing with it may or may not be
+ * included, but none is ever lost.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/sharded_counter.hpp"
+ *
+ * mystic::concurrency::sharded_counter requests;
+ *
+ * // Every event, on every core
+ * requests.increment();
+ *
+ * // Metrics scrape
+ * uint64_t total = requests.read();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/internal/cpu_slot.hpp"
+#include "mystic/concurrency/per_cpu.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief 64-bit counter sharded per CPU.
+ */
+class sharded_counter {
+public:
+    sharded_counter() = default;
+    sharded_counter(const sharded_counter&) = delete;
+    sharded_counter& operator=(const sharded_counter&) = delete;
+
+    /**
+     * @brief Adds value to the counter.
+     */
+    MYSTIC_FORCEINLINE void add(::mystic::types::uint64_t value) noexcept {
+#if MYSTIC_CONCURRENCY_HAS_RSEQ_ADD
+        if (MYSTIC_LIKELY(internal::rseqArea() != nullptr)) {
+            addRseq(value);
+            return;
+        }
+#endif
+        slots_.local().fetch_add(value, std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds one to the counter.
+     */
+    MYSTIC_FORCEINLINE void increment() noexcept { add(1); }
+
+    /**
+     * @brief Returns the sum of every slot.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t read() const noexcept {
+        ::mystic::types::uint64_t total = unsharded_.load(std::memory_order_relaxed);
+        slots_.for_each([&total](const std::atomic<::mystic::types::uint64_t>& slot) {
+            total += slot.load(std::memory_order_relaxed);
+        });
+        return total;
+    }
+
+private:
+#if MYSTIC_CONCURRENCY_HAS_RSEQ_ADD
+    /**
+     * @brief Adds through rseq. Every thread of the process is registered,
+     * so every CPU slot is only ever written by its CPU's rseq adds.
+     */
+    MYSTIC_FORCEINLINE void addRseq(::mystic::types::uint64_t value) noexcept {
+        static_assert(sizeof(std::atomic<::mystic::types::uint64_t>) ==
+                          sizeof(::mystic::types::uint64_t),
+                      "rseq add requires a plain 64-bit atomic.");
+        for (;;) {
+            const ::mystic::types::uint32_t cpu = internal::currentCpu();
+            if (MYSTIC_UNLIKELY(cpu >= slots_.size())) {
+                // Thread without rseq (e.g. raw clone), keep off the CPU slots.
+                unsharded_.fetch_add(value, std::memory_order_relaxed);
+                return;
+            }
+            auto* word = reinterpret_cast<::mystic::types::uint64_t*>(&slots_[cpu]);
+            if (MYSTIC_LIKELY(internal::rseqAdd(word, value, cpu))) {
+                return;
+            }
+        }
+    }
+#endif
+
+    /// Per-CPU counts
+    per_cpu<std::atomic<::mystic::types::uint64_t>> slots_;
+
+    /// Count of threads whose CPU is unknown while rseq is in use
+    std::atomic<::mystic::types::uint64_t> unsharded_{0};
+
+}; // class sharded_counter
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,245 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/shared_mutex_distributed.hpp
+ * @file shared_mutex_distributed.hpp
+ * @brief Defines reader-biased reader-writer lock with distributed reader counters.
+ *
+ * @details
+ * This header provides `shared_mutex_distributed`, a reader-writer lock
+ * with the interface of `std::shared_mutex`, for data which is read very
+ * often and written rarely.
+ *
+ * Readers increment a cache-line-padded slot picked per thread, instead
+ * of one shared counter, so concurrent readers on different cores never
+ * touch the same cache line. Writers set a flag, then wait for every slot
+ * to drain, so writes are expensive (O(slots)) and should be rare.
+ *
+ * A pending writer turns away new readers, so writers are not starved.
+ * Readers turned away wait through the `WaitStrategy` template parameter
+ * (see `wait_strategy.hpp`), `shared_mutex_distributed` uses
+ * `spin_then_park`.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/shared_mutex_distributed.hpp"
+ *
+ * mystic::concurrency::shared_mutex_distributed routes_lock;
+ *
+ * // Readers (hot)
+ * {
+ *     std::shared_lock<mystic::concurrency::shared_mutex_distributed> guard(routes_lock);
+ *     lookup(routes, key);
+ * }
+ *
+ * // Writer (about once a minute)
+ * {
+ *     std::unique_lock<mystic::concurrency::shared_mutex_distributed> guard(routes_lock);
+ *     routes = reload();
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/cpu_relax.hpp"
+#include "mystic/concurrency/internal/cpu_slot.hpp"
+#include "mystic/concurrency/mutex.hpp"
+#include "mystic/concurrency/wait_strategy.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Reader-writer lock with per-thread reader slots.
+ *
+ * @tparam WaitStrategy How readers wait for a writer to finish.
+ */
+template <typename WaitStrategy>
+class basic_shared_mutex_distributed {
+public:
+    /// Number of reader slots (a power of two).
+    static constexpr ::mystic::types::size_t kSlotCount = 64;
+
+    /// Number of spins before a draining writer yields.
+    static constexpr ::mystic::types::uint32_t kSpinLimit = 64;
+
+    basic_shared_mutex_distributed() noexcept = default;
+    basic_shared_mutex_distributed(const basic_shared_mutex_distributed&) = delete;
+    basic_shared_mutex_distributed& operator=(const basic_shared_mutex_distributed&) = delete;
+
+    /**
+     * @brief Acquires shared ownership.
+     */
+    void lock_shared() noexcept {
+        ReaderSlot& slot = localSlot();
+        while (!tryEnter(slot)) {
+            waitForWriter();
+        }
+    }
+
+    /**
+     * @brief Acquires shared ownership, fails if a writer is active or pending.
+     */
+    MYSTIC_NODISCARD bool try_lock_shared() noexcept { return tryEnter(localSlot()); }
+
+    /**
+     * @brief Releases shared ownership, on the thread which acquired it.
+     */
+    void unlock_shared() noexcept {
+        localSlot().readers.fetch_sub(1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Acquires exclusive ownership, waits for every reader to leave.
+     */
+    void lock() noexcept {
+        writer_lock_.lock();
+        state_.fetch_or(kWriter, std::memory_order_seq_cst);
+        drainReaders();
+    }
+
+    /**
+     * @brief Acquires exclusive ownership, fails if any reader or writer is active.
+     */
+    MYSTIC_NODISCARD bool try_lock() noexcept {
+        if (!writer_lock_.try_lock()) {
+            return false;
+        }
+        state_.fetch_or(kWriter, std::memory_order_seq_cst);
+        for (const ReaderSlot& slot : slots_) {
+            if (slot.readers.load(std::memory_order_acquire) != 0) {
+                unlock();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Releases exclusive ownership, and wakes the waiting readers.
+     */
+    void unlock() noexcept {
+        const ::mystic::types::uint32_t previous =
+            state_.exchange(0, std::memory_order_release);
+        writer_lock_.unlock();
+        if ((previous & kWaiting) != 0) {
+            WaitStrategy::notify_all(state_);
+        }
+    }
+
+private:
+    /// Set while a writer is active or pending.
+    static constexpr ::mystic::types::uint32_t kWriter = 1;
+
+    /// Set while readers may be asleep waiting for the writer.
+    static constexpr ::mystic::types::uint32_t kWaiting = 2;
+
+    /**
+     * @brief Reader count of one slot, padded to its own cache line.
+     */
+    struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) ReaderSlot {
+        std::atomic<::mystic::types::size_t> readers{0};
+    }; // struct ReaderSlot
+
+    ReaderSlot& localSlot() noexcept {
+        return slots_[internal::threadSlotIndex() & (kSlotCount - 1)];
+    }
+
+    /**
+     * @brief Announces a reader in slot, backs off if a writer is around.
+     */
+    bool tryEnter(ReaderSlot& slot) noexcept {
+        // Sequentially consistent on both sides: either the writer sees
+        // this increment while draining, or this reader sees the writer.
+        slot.readers.fetch_add(1, std::memory_order_seq_cst);
+        if (MYSTIC_LIKELY((state_.load(std::memory_order_seq_cst) & kWriter) == 0)) {
+            return true;
+        }
+        slot.readers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    MYSTIC_NOINLINE void waitForWriter() noexcept {
+        ::mystic::types::uint32_t state = state_.load(std::memory_order_relaxed);
+        while ((state & kWriter) != 0) {
+            if constexpr (WaitStrategy::kMayPark) {
+                // Ask the writer to notify, before going to sleep.
+                if ((state & kWaiting) == 0 &&
+                    !state_.compare_exchange_weak(state, state | kWaiting,
+                                                  std::memory_order_relaxed,
+                                                  std::memory_order_relaxed)) {
+                    continue;
+                }
+                state |= kWaiting;
+            }
+            WaitStrategy::wait(state_, state);
+            state = state_.load(std::memory_order_relaxed);
+        }
+    }
+
+    void drainReaders() noexcept {
+        for (const ReaderSlot& slot : slots_) {
+            ::mystic::types::uint32_t spins = 0;
+            while (slot.readers.load(std::memory_order_acquire) != 0) {
+                if (spins < kSpinLimit) {
+                    ++spins;
+                    cpu_relax();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+        }
+    }
+
+    /// Per-thread reader counts
+    ReaderSlot slots_[kSlotCount];
+
+    /// Writer state, kWriter | kWaiting
+    std::atomic<::mystic::types::uint32_t> state_{0};
+
+    /// Serializes writers
+    mutex writer_lock_;
+
+}; // class basic_shared_mutex_distributed
+
+/**
+ * @brief Distributed reader-writer lock, whose readers spin, then park.
+ */
+using shared_mutex_distributed = basic_shared_mutex_distributed<spin_then_park>;
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,279 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/wait_strategy.hpp
+ * @file wait_strategy.hpp
+ * @brief Defines pluggable wait strategies for blocking primitives.
+ *
+ * @details
+ * This header provides wait strategies, which decide how a thread waits
+ * for a 32-bit atomic word to change. Blocking primitives and queues take
+ * one as a template parameter, so the trade between latency and CPU use
+ * is picked per use site:
+ *
+ * 1. `busy_spin` never gives up the CPU, lowest latency, burns a core.
+ * 2. `spin_then_yield` spins briefly, then yields the time slice.
+ * 3. `spin_then_park` spins with bounded exponential backoff, then parks
+ *    on the parking lot (a futex per thread on Linux). The default.
+ *
+ * A wait strategy is a type with these static members:
+ *
+ * - `void wait(const std::atomic<uint32_t>& word, uint32_t old)`, returns
+ *   once word no longer holds old.
+ * - `bool wait_until(word, old, steady_clock::time_point deadline)`, same,
+ *   returns false if the deadline passed first.
+ * - `bool wait_until(word, old, deadline, interrupted)`, same, also returns
+ *   false once `interrupted()` holds. Whoever makes it hold must then call
+ *   `notify_all(word)`, a cancellation callback, for example.
+ * - `void notify_one(word)` / `void notify_all(word)`, called after word
+ *   changed.
+ * - `bool kMayPark`, true if waiters can sleep. Primitives use it to skip
+ *   tracking waiters (and notify calls) when nobody can be asleep.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/wait_strategy.hpp"
+ *
+ * template <typename WaitStrategy = mystic::concurrency::spin_then_park>
+ * class event {
+ *     void wait() { WaitStrategy::wait(state_, 0); }
+ *     void set() { state_.store(1); WaitStrategy::notify_all(state_); }
+ *     std::atomic<uint32_t> state_{0};
+ * };
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/cpu_relax.hpp"
+#include "mystic/concurrency/parking_lot.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief Spins until the word changes, never gives up the CPU.
+ */
+struct busy_spin {
+    static constexpr bool kMayPark = false;
+
+    static void wait(const std::atomic<::mystic::types::uint32_t>& word,
+                     ::mystic::types::uint32_t old) noexcept {
+        while (word.load(std::memory_order_acquire) == old) {
+            cpu_relax();
+        }
+    }
+
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline) noexcept {
+        while (word.load(std::memory_order_acquire) == old) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            cpu_relax();
+        }
+        return true;
+    }
+
+    template <typename Interrupted>
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline,
+                           Interrupted&& interrupted) {
+        while (word.load(std::memory_order_acquire) == old) {
+            if (interrupted() || std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            cpu_relax();
+        }
+        return true;
+    }
+
+    static void notify_one(const std::atomic<::mystic::types::uint32_t>&) noexcept {}
+    static void notify_all(const std::atomic<::mystic::types::uint32_t>&) noexcept {}
+}; // struct busy_spin
+
+/**
+ * @brief Spins briefly, then yields the time slice until the word changes.
+ */
+struct spin_then_yield {
+    static constexpr bool kMayPark = false;
+
+    /// Number of spins before yielding.
+    static constexpr ::mystic::types::uint32_t kSpinLimit = 128;
+
+    static void wait(const std::atomic<::mystic::types::uint32_t>& word,
+                     ::mystic::types::uint32_t old) noexcept {
+        ::mystic::types::uint32_t spins = 0;
+        while (word.load(std::memory_order_acquire) == old) {
+            relax(spins);
+        }
+    }
+
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline) noexcept {
+        ::mystic::types::uint32_t spins = 0;
+        while (word.load(std::memory_order_acquire) == old) {
+            if (std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            relax(spins);
+        }
+        return true;
+    }
+
+    template <typename Interrupted>
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline,
+                           Interrupted&& interrupted) {
+        ::mystic::types::uint32_t spins = 0;
+        while (word.load(std::memory_order_acquire) == old) {
+            if (interrupted() || std::chrono::steady_clock::now() >= deadline) {
+                return false;
+            }
+            relax(spins);
+        }
+        return true;
+    }
+
+    static void notify_one(const std::atomic<::mystic::types::uint32_t>&) noexcept {}
+    static void notify_all(const std::atomic<::mystic::types::uint32_t>&) noexcept {}
+
+private:
+    static void relax(::mystic::types::uint32_t& spins) noexcept {
+        if (spins < kSpinLimit) {
+            ++spins;
+            cpu_relax();
+        } else {
+            std::this_thread::yield();
+        }
+    }
+}; // struct spin_then_yield
+
+/**
+ * @brief Spins with bounded exponential backoff, then parks.
+ *
+ * Parking goes through the parking lot, whose bucket lock orders the
+ * sleep against notify, so no wakeup is lost, even for interrupted waits,
+ * and notifying a word nobody sleeps on makes no syscall.
+ */
+struct spin_then_park {
+    static constexpr bool kMayPark = true;
+
+    /// Number of backoff rounds before parking.
+    static constexpr ::mystic::types::uint32_t kSpinRounds = 10;
+
+    /// Upper bound of cpu_relax() calls in one backoff round.
+    static constexpr ::mystic::types::uint32_t kMaxBackoff = 64;
+
+    static void wait(const std::atomic<::mystic::types::uint32_t>& word,
+                     ::mystic::types::uint32_t old) noexcept {
+        if (MYSTIC_LIKELY(spin(word, old))) {
+            return;
+        }
+        while (word.load(std::memory_order_acquire) == old) {
+            parking_lot::park(
+                &word, [&word, old] { return word.load(std::memory_order_relaxed) == old; },
+                [] {});
+        }
+    }
+
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline) noexcept {
+        return wait_until(word, old, deadline, [] { return false; });
+    }
+
+    template <typename Interrupted>
+    static bool wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                           ::mystic::types::uint32_t old,
+                           std::chrono::steady_clock::time_point deadline,
+                           Interrupted&& interrupted) {
+        if (MYSTIC_LIKELY(spin(word, old))) {
+            return true;
+        }
+        const bool forever = deadline == std::chrono::steady_clock::time_point::max();
+        while (word.load(std::memory_order_acquire) == old) {
+            if (interrupted()) {
+                return false;
+            }
+            // Validated under the bucket lock, so an interrupter which then
+            // notifies either stops the park here, or finds us queued.
+            const parking_lot::park_result result = parking_lot::park_until(
+                &word,
+                [&] {
+                    return word.load(std::memory_order_relaxed) == old && !interrupted();
+                },
+                [] {}, forever ? nullptr : &deadline);
+            if (result.timed_out) {
+                return word.load(std::memory_order_acquire) != old;
+            }
+        }
+        return true;
+    }
+
+    static void notify_one(const std::atomic<::mystic::types::uint32_t>& word) noexcept {
+        parking_lot::unpark_one(&word);
+    }
+
+    static void notify_all(const std::atomic<::mystic::types::uint32_t>& word) noexcept {
+        parking_lot::unpark_all(&word);
+    }
+
+private:
+    /**
+     * @returns True if the word changed while spinning.
+     */
+    static bool spin(const std::atomic<::mystic::types::uint32_t>& word,
+                     ::mystic::types::uint32_t old) noexcept {
+        ::mystic::types::uint32_t backoff = 1;
+        for (::mystic::types::uint32_t round = 0; round < kSpinRounds; ++round) {
+            if (word.load(std::memory_order_acquire) != old) {
+                return true;
+            }
+            for (::mystic::types::uint32_t index = 0; index < backoff; ++index) {
+                cpu_relax();
+            }
+            backoff = backoff < kMaxBackoff ? backoff * 2 : kMaxBackoff;
+        }
+        return word.load(std::memory_order_acquire) != old;
+    }
+}; // struct spin_then_park
+
+} // namespace concurrency
+} // namespace mystic
@@ -0,0 +1,123 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/concurrency/word_lock.hpp
+ * @file word_lock.hpp
+ * @brief Defines 1-byte low-level spin lock.
+ *
+ * @details
+ * This header provides `word_lock`, a 1-byte lock which spins, then yields.
+ * It never parks, so it has no dependency on the parking lot, and is meant
+ * for critical sections of a few instructions (like the parking lot's own
+ * buckets). For anything longer, use `mystic::concurrency::mutex`.
+ *
+ * @code{.cpp}
+ * #include "mystic/concurrency/word_lock.hpp"
+ *
+ * mystic::concurrency::word_lock lock;
+ *
+ * {
+ *     std::lock_guard<mystic::concurrency::word_lock> guard(lock);
+ *     // ... tiny critical section
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <thread>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/cpu_relax.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::concurrency
+ * @brief Concurrency primitives.
+ */
+namespace concurrency {
+
+/**
+ * @brief 1-byte lock which spins, then yields, and never parks.
+ */
+class word_lock {
+public:
+    /// Number of spins before yielding the CPU.
+    static constexpr ::mystic::types::uint32_t kSpinLimit = 64;
+
+    constexpr word_lock() noexcept = default;
+    word_lock(const word_lock&) = delete;
+    word_lock& operator=(const word_lock&) = delete;
+
+    MYSTIC_NODISCARD bool try_lock() noexcept {
+        return !locked_.load(std::memory_order_relaxed) &&
+               !locked_.exchange(true, std::memory_order_acquire);
+    }
+
+    void lock() noexcept {
+        if (MYSTIC_LIKELY(!locked_.exchange(true, std::memory_order_acquire))) {
+            return;
+        }
+        lockSlow();
+    }
+
+    void unlock() noexcept { locked_.store(false, std::memory_order_release); }
+
+    /**
+     * @brief Returns true if the lock is held (by anyone).
+     */
+    bool is_locked() const noexcept { return locked_.load(std::memory_order_relaxed); }
+
+private:
+    MYSTIC_NOINLINE void lockSlow() noexcept {
+        ::mystic::types::uint32_t spins = 0;
+        for (;;) {
+            // Spin on a plain load, to keep the line shared while waiting.
+            while (locked_.load(std::memory_order_relaxed)) {
+                if (spins < kSpinLimit) {
+                    ++spins;
+                    cpu_relax();
+                } else {
+                    std::this_thread::yield();
+                }
+            }
+            if (!locked_.exchange(true, std::memory_order_acquire)) {
+                return;
+            }
+        }
+    }
+
+    /// Lock state
+    std::atomic<bool> locked_{false};
+
+}; // class word_lock
+
+static_assert(sizeof(word_lock) == 1, "word_lock must be 1 byte.");
+
+} // namespace concurrency
+} // namespace mystic
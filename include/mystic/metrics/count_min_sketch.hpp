@@ -0,0 +1,355 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/count_min_sketch.hpp
+ * @file count_min_sketch.hpp
+ * @brief Defines Count-Min sketch with heavy hitter tracking.
+ *
+ * @details
+ * This header provides `count_min_sketch` (Cormode and Muthukrishnan),
+ * which estimates how often each key of a stream occurred, in memory
+ * independent of the number of keys. An estimate is never below the true
+ * count, and exceeds it by at most epsilon * total with probability
+ * 1 - delta.
+ *
+ * 1. Updates are conservative (Estan and Varghese): only the rows holding
+ *    the minimum are raised, which leaves the guarantee intact and cuts
+ *    the overestimate of rare keys substantially.
+ * 2. The depth row indices come from one 64-bit hash, split in two
+ *    (Kirsch and Mitzenmacher), and the width is a power of two, so an
+ *    update is one hash and depth masked loads.
+ * 3. With top_k > 0, the k keys with the highest estimates are kept in a
+ *    min-heap. A key whose estimate does not beat the heap minimum costs
+ *    one comparison, so only heavy keys ever touch the heap.
+ *
+ * Updates are unsynchronized, so each thread should count into its own
+ * `count_min_sketch`. Their counts add up with `merge()`, provided both
+ * share width and depth (the same epsilon and delta) and the same Hash.
+ *
+ * @code{.cpp}
+ * #include "mystic/metrics/count_min_sketch.hpp"
+ *
+ * mystic::metrics::count_min_sketch<std::string> errors(0.001, 0.01, 10);
+ *
+ * errors.add(message);
+ *
+ * for (const auto& hitter : errors.top()) {
+ *     log(hitter.key, hitter.count);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/metrics/internal/hash.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::metrics
+ * @brief Metrics, histograms and sketches.
+ */
+namespace metrics {
+
+/**
+ * @brief Frequency sketch with conservative update and top-k tracking.
+ *
+ * @tparam Key The key type, integers and strings are supported.
+ * @tparam Hash Hash of Key returning a uniform 64-bit value.
+ */
+template <typename Key = std::string, typename Hash = internal::SketchHash<Key>>
+class count_min_sketch {
+public:
+    using key_type = Key;
+
+    /**
+     * @brief A tracked key with its estimated count.
+     */
+    struct heavy_hitter {
+        Key key;
+        ::mystic::types::uint64_t count;
+    }; // struct heavy_hitter
+
+    /// Largest number of rows.
+    static constexpr ::mystic::types::size_t kMaxDepth = 16;
+
+    /**
+     * @brief Constructs an empty sketch.
+     *
+     * @param epsilon The error bound, relative to the total count (the
+     *                width is e / epsilon, rounded up to a power of two).
+     * @param delta The probability of exceeding the bound (the depth is
+     *              ln(1 / delta), at most kMaxDepth).
+     * @param top_k The number of heaviest keys to track, 0 for none.
+     */
+    explicit count_min_sketch(double epsilon = 0.001, double delta = 0.01,
+                              ::mystic::types::size_t top_k = 0)
+        : top_k_(top_k) {
+        if (!(epsilon > 0.0 && epsilon < 1.0)) {
+            epsilon = 0.001;
+        }
+        if (!(delta > 0.0 && delta < 1.0)) {
+            delta = 0.01;
+        }
+        constexpr double kE = 2.71828182845904523536;
+        const auto min_width = static_cast<::mystic::types::size_t>(std::ceil(kE / epsilon));
+        width_ = 1;
+        while (width_ < min_width) {
+            width_ <<= 1;
+        }
+        depth_ = static_cast<::mystic::types::size_t>(std::ceil(std::log(1.0 / delta)));
+        depth_ = std::clamp<::mystic::types::size_t>(depth_, 1, kMaxDepth);
+        counters_.assign(width_ * depth_, 0);
+        heap_.reserve(top_k_);
+    }
+
+    /**
+     * @brief Adds count occurrences of key.
+     *
+     * @returns The new estimate of key.
+     */
+    ::mystic::types::uint64_t add(const Key& key, ::mystic::types::uint64_t count = 1) {
+        ::mystic::types::size_t slots[kMaxDepth];
+        locate(key, slots);
+
+        ::mystic::types::uint64_t minimum = std::numeric_limits<::mystic::types::uint64_t>::max();
+        for (::mystic::types::size_t row = 0; row < depth_; ++row) {
+            minimum = std::min(minimum, counters_[slots[row]]);
+        }
+        const ::mystic::types::uint64_t estimate = minimum + count;
+        for (::mystic::types::size_t row = 0; row < depth_; ++row) {
+            counters_[slots[row]] = std::max(counters_[slots[row]], estimate);
+        }
+        total_ += count;
+
+        if (top_k_ != 0 && (heap_.size() < top_k_ || estimate > heap_[0].count)) {
+            track(key, estimate);
+        }
+        return estimate;
+    }
+
+    /**
+     * @brief Returns the estimated count of key, never below the true count.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t estimate(const Key& key) const {
+        ::mystic::types::size_t slots[kMaxDepth];
+        locate(key, slots);
+
+        ::mystic::types::uint64_t minimum = std::numeric_limits<::mystic::types::uint64_t>::max();
+        for (::mystic::types::size_t row = 0; row < depth_; ++row) {
+            minimum = std::min(minimum, counters_[slots[row]]);
+        }
+        return minimum;
+    }
+
+    /**
+     * @brief Adds every count of other, and re-ranks the tracked keys of
+     * both.
+     *
+     * @returns False (merging nothing) if other has another width or depth.
+     */
+    bool merge(const count_min_sketch& other) {
+        if (other.width_ != width_ || other.depth_ != depth_) {
+            return false;
+        }
+        if (&other == this) {
+            return true;
+        }
+        for (::mystic::types::size_t slot = 0; slot < counters_.size(); ++slot) {
+            counters_[slot] += other.counters_[slot];
+        }
+        total_ += other.total_;
+
+        if (top_k_ != 0) {
+            std::vector<heavy_hitter> candidates;
+            candidates.reserve(heap_.size() + other.heap_.size());
+            for (const heavy_hitter& hitter : heap_) {
+                candidates.push_back(heavy_hitter{hitter.key, 0});
+            }
+            for (const heavy_hitter& hitter : other.heap_) {
+                if (positions_.find(hitter.key) == positions_.end()) {
+                    candidates.push_back(heavy_hitter{hitter.key, 0});
+                }
+            }
+            heap_.clear();
+            positions_.clear();
+            for (heavy_hitter& candidate : candidates) {
+                const ::mystic::types::uint64_t count = estimate(candidate.key);
+                if (heap_.size() < top_k_ || count > heap_[0].count) {
+                    track(candidate.key, count);
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns the tracked keys, highest count first.
+     */
+    MYSTIC_NODISCARD std::vector<heavy_hitter> top() const {
+        std::vector<heavy_hitter> result(heap_);
+        std::sort(result.begin(), result.end(),
+                  [](const heavy_hitter& a, const heavy_hitter& b) { return a.count > b.count; });
+        return result;
+    }
+
+    /**
+     * @brief Removes every count and tracked key.
+     */
+    void clear() noexcept {
+        std::fill(counters_.begin(), counters_.end(), 0);
+        heap_.clear();
+        positions_.clear();
+        total_ = 0;
+    }
+
+    MYSTIC_NODISCARD ::mystic::types::size_t width() const noexcept { return width_; }
+    MYSTIC_NODISCARD ::mystic::types::size_t depth() const noexcept { return depth_; }
+
+    /**
+     * @brief Returns the sum of every added count.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t total() const noexcept { return total_; }
+
+    /**
+     * @brief Returns the memory used by the counters, in bytes.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t memory_size() const noexcept {
+        return counters_.size() * sizeof(::mystic::types::uint64_t);
+    }
+
+private:
+    /**
+     * @brief Adapts Hash to the size_t hash the position map needs.
+     */
+    struct MapHash {
+        ::mystic::types::size_t operator()(const Key& key) const noexcept {
+            return static_cast<::mystic::types::size_t>(Hash{}(key));
+        }
+    }; // struct MapHash
+
+    /**
+     * @brief Computes the counter index of key in every row.
+     */
+    MYSTIC_FORCEINLINE void locate(const Key& key, ::mystic::types::size_t* slots) const noexcept {
+        const ::mystic::types::uint64_t hash = Hash{}(key);
+        const auto first = static_cast<::mystic::types::uint32_t>(hash);
+        const auto second = static_cast<::mystic::types::uint32_t>(hash >> 32) | 1;
+        const ::mystic::types::size_t mask = width_ - 1;
+        for (::mystic::types::size_t row = 0; row < depth_; ++row) {
+            slots[row] = row * width_ +
+                         (static_cast<::mystic::types::size_t>(first + row * second) & mask);
+        }
+    }
+
+    /**
+     * @brief Records a new estimate of key, which beats the heap minimum
+     * or fills a free place.
+     */
+    MYSTIC_NOINLINE void track(const Key& key, ::mystic::types::uint64_t count) {
+        const auto found = positions_.find(key);
+        if (found != positions_.end()) {
+            // Estimates only grow, so the entry can only sink.
+            heap_[found->second].count = count;
+            siftDown(found->second);
+            return;
+        }
+        if (heap_.size() < top_k_) {
+            heap_.push_back(heavy_hitter{key, count});
+            positions_.emplace(key, heap_.size() - 1);
+            siftUp(heap_.size() - 1);
+            return;
+        }
+        positions_.erase(heap_[0].key);
+        heap_[0] = heavy_hitter{key, count};
+        positions_.emplace(key, 0);
+        siftDown(0);
+    }
+
+    void swapEntries(::mystic::types::size_t a, ::mystic::types::size_t b) {
+        std::swap(heap_[a], heap_[b]);
+        positions_[heap_[a].key] = a;
+        positions_[heap_[b].key] = b;
+    }
+
+    void siftUp(::mystic::types::size_t position) {
+        while (position > 0) {
+            const ::mystic::types::size_t parent = (position - 1) / 2;
+            if (heap_[parent].count <= heap_[position].count) {
+                return;
+            }
+            swapEntries(parent, position);
+            position = parent;
+        }
+    }
+
+    void siftDown(::mystic::types::size_t position) {
+        for (;;) {
+            ::mystic::types::size_t smallest = position;
+            const ::mystic::types::size_t left = 2 * position + 1;
+            const ::mystic::types::size_t right = left + 1;
+            if (left < heap_.size() && heap_[left].count < heap_[smallest].count) {
+                smallest = left;
+            }
+            if (right < heap_.size() && heap_[right].count < heap_[smallest].count) {
+                smallest = right;
+            }
+            if (smallest == position) {
+                return;
+            }
+            swapEntries(smallest, position);
+            position = smallest;
+        }
+    }
+
+    ::mystic::types::size_t width_ = 1;
+    ::mystic::types::size_t depth_ = 1;
+    ::mystic::types::size_t top_k_;
+    ::mystic::types::uint64_t total_ = 0;
+
+    /// depth_ rows of width_ counters
+    std::vector<::mystic::types::uint64_t> counters_;
+
+    /// Min-heap of the tracked keys, by count
+    std::vector<heavy_hitter> heap_;
+
+    /// Position in heap_ of every tracked key
+    std::unordered_map<Key, ::mystic::types::size_t, MapHash> positions_;
+
+}; // class count_min_sketch
+
+} // namespace metrics
+} // namespace mystic
@@ -0,0 +1,390 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/ddsketch.hpp
+ * @file ddsketch.hpp
+ * @brief Defines DDSketch, a mergeable quantile sketch with relative error.
+ *
+ * @details
+ * This header provides `ddsketch` (Masson, Rim and Lee, "DDSketch: A
+ * Fast and Fully-Mergeable Quantile Sketch with Relative-Error
+ * Guarantees"), for streams whose value range is not known upfront.
+ *
+ * A value x goes to bin ceil(log(x) / log(gamma)), with
+ * gamma = (1 + a) / (1 - a), so every quantile is returned within a
+ * relative error a of a value of the stream. Bins are kept in a dense
+ * array, and when the range outgrows max_bins the lowest bins are folded
+ * together, which keeps memory bounded and sacrifices only the lowest
+ * quantiles (high quantiles are what latency reports need).
+ *
+ * 1. `add()` is one logarithm and one increment.
+ * 2. `merge()` adds bins index by index, so merging is exact, and any
+ *    number of per-thread or per-process sketches (with the same
+ *    accuracy) can be combined.
+ *
+ * `ddsketch` has no internal synchronization. Concurrent writers each
+ * fill their own sketch, and a reader combines them with `merge()`, which
+ * refuses a sketch built with another relative accuracy.
+ *
+ * @code{.cpp}
+ * #include "mystic/metrics/ddsketch.hpp"
+ *
+ * mystic::metrics::ddsketch latency(0.01); // 1% relative error
+ *
+ * latency.add(elapsed_ms);
+ *
+ * double p99 = latency.quantile(0.99);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::metrics::internal {
+
+/**
+ * @brief Contiguous bin counts, folding the lowest bins past a size limit.
+ */
+class CollapsingDenseStore {
+public:
+    explicit CollapsingDenseStore(::mystic::types::size_t max_bins) noexcept
+        : max_bins_(max_bins < 1 ? 1 : max_bins) {}
+
+    void add(::mystic::types::int32_t index, ::mystic::types::uint64_t count) {
+        if (MYSTIC_UNLIKELY(counts_.empty())) {
+            counts_.assign(1, 0);
+            offset_ = index;
+        } else if (MYSTIC_UNLIKELY(index < offset_ || index >= end())) {
+            index = extend(index);
+        }
+        counts_[static_cast<::mystic::types::size_t>(index - offset_)] += count;
+        total_ += count;
+    }
+
+    /**
+     * @brief Adds every bin of other.
+     */
+    void merge(const CollapsingDenseStore& other) {
+        for (::mystic::types::size_t position = 0; position < other.counts_.size(); ++position) {
+            if (other.counts_[position] != 0) {
+                add(other.offset_ + static_cast<::mystic::types::int32_t>(position),
+                    other.counts_[position]);
+            }
+        }
+    }
+
+    void clear() noexcept {
+        counts_.clear();
+        total_ = 0;
+    }
+
+    ::mystic::types::uint64_t total() const noexcept { return total_; }
+    ::mystic::types::size_t binCount() const noexcept { return counts_.size(); }
+
+    /**
+     * @brief Calls fn(index, count) for every non-empty bin, ascending if
+     * ascending is true, descending otherwise, until fn returns false.
+     */
+    template <typename Function>
+    void forEach(bool ascending, Function&& fn) const {
+        const ::mystic::types::size_t size = counts_.size();
+        for (::mystic::types::size_t step = 0; step < size; ++step) {
+            const ::mystic::types::size_t position = ascending ? step : size - 1 - step;
+            if (counts_[position] != 0 &&
+                !fn(offset_ + static_cast<::mystic::types::int32_t>(position), counts_[position])) {
+                return;
+            }
+        }
+    }
+
+private:
+    ::mystic::types::int32_t end() const noexcept {
+        return offset_ + static_cast<::mystic::types::int32_t>(counts_.size());
+    }
+
+    /**
+     * @brief Grows the range to cover index, folding the lowest bins if it
+     * would exceed max_bins_.
+     *
+     * @returns The bin index to count into (index, unless folded).
+     */
+    MYSTIC_NOINLINE ::mystic::types::int32_t extend(::mystic::types::int32_t index) {
+        const auto max_bins = static_cast<::mystic::types::int64_t>(max_bins_);
+        if (index < offset_) {
+            const ::mystic::types::int64_t high = end() - 1;
+            ::mystic::types::int64_t low = index;
+            if (high - low + 1 > max_bins) {
+                low = high - max_bins + 1;
+            }
+            counts_.insert(counts_.begin(), static_cast<::mystic::types::size_t>(offset_ - low), 0);
+            offset_ = static_cast<::mystic::types::int32_t>(low);
+            return index < offset_ ? offset_ : index;
+        }
+
+        const ::mystic::types::int64_t span = static_cast<::mystic::types::int64_t>(index) -
+                                              offset_ + 1;
+        if (span > max_bins) {
+            // Fold the lowest bins into the new lowest one.
+            const ::mystic::types::int64_t shift = span - max_bins;
+            ::mystic::types::uint64_t folded = 0;
+            const ::mystic::types::size_t dropped =
+                shift < static_cast<::mystic::types::int64_t>(counts_.size())
+                    ? static_cast<::mystic::types::size_t>(shift)
+                    : counts_.size();
+            for (::mystic::types::size_t position = 0; position < dropped; ++position) {
+                folded += counts_[position];
+            }
+            counts_.erase(counts_.begin(), counts_.begin() + static_cast<std::ptrdiff_t>(dropped));
+            offset_ = static_cast<::mystic::types::int32_t>(offset_ + shift);
+            if (counts_.empty()) {
+                counts_.assign(1, 0);
+            }
+            counts_[0] += folded;
+        }
+        counts_.resize(static_cast<::mystic::types::size_t>(index - offset_ + 1), 0);
+        return index;
+    }
+
+    ::mystic::types::size_t max_bins_;
+
+    /// Index of counts_[0]
+    ::mystic::types::int32_t offset_ = 0;
+
+    std::vector<::mystic::types::uint64_t> counts_;
+    ::mystic::types::uint64_t total_ = 0;
+
+}; // class CollapsingDenseStore
+
+} // namespace mystic::metrics::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::metrics
+ * @brief Metrics, histograms and sketches.
+ */
+namespace metrics {
+
+/**
+ * @brief Quantile sketch with a relative-error guarantee.
+ */
+class ddsketch {
+public:
+    /// Default bound on the number of bins, per sign.
+    static constexpr ::mystic::types::size_t kDefaultMaxBins = 2048;
+
+    /// Smallest relative accuracy, finer ones are clamped to it. Every
+    /// finite double then has a bin index of magnitude below 2^29.
+    static constexpr double kMinRelativeAccuracy = 1e-6;
+
+    /**
+     * @brief Constructs an empty sketch.
+     *
+     * @param relative_accuracy The relative error of quantiles, in (0, 1),
+     *                          clamped to at least kMinRelativeAccuracy.
+     * @param max_bins The number of bins kept per sign, 2048 bins at 1%
+     *                 cover values spanning about 17.8 decades.
+     */
+    explicit ddsketch(double relative_accuracy = 0.01,
+                      ::mystic::types::size_t max_bins = kDefaultMaxBins)
+        : positive_(max_bins), negative_(max_bins) {
+        if (!(relative_accuracy > 0.0 && relative_accuracy < 1.0)) {
+            relative_accuracy = 0.01;
+        } else if (relative_accuracy < kMinRelativeAccuracy) {
+            relative_accuracy = kMinRelativeAccuracy;
+        }
+        relative_accuracy_ = relative_accuracy;
+        gamma_ = (1.0 + relative_accuracy) / (1.0 - relative_accuracy);
+        multiplier_ = 1.0 / std::log(gamma_);
+        min_indexable_ = std::numeric_limits<double>::min() * gamma_;
+    }
+
+    /**
+     * @brief Adds count occurrences of value (NaN and infinities are
+     * ignored, they have no bin).
+     */
+    void add(double value, ::mystic::types::uint64_t count = 1) {
+        if (MYSTIC_UNLIKELY(!std::isfinite(value) || count == 0)) {
+            return;
+        }
+        if (value >= min_indexable_) {
+            positive_.add(index(value), count);
+        } else if (value <= -min_indexable_) {
+            negative_.add(index(-value), count);
+        } else {
+            zero_count_ += count;
+        }
+        count_ += count;
+        sum_ += value * static_cast<double>(count);
+        if (value < min_) {
+            min_ = value;
+        }
+        if (value > max_) {
+            max_ = value;
+        }
+    }
+
+    /**
+     * @brief Adds every value of other.
+     *
+     * @returns False (merging nothing) if other has another accuracy.
+     */
+    bool merge(const ddsketch& other) {
+        if (other.gamma_ != gamma_) {
+            return false;
+        }
+        if (other.count_ == 0) {
+            return true;
+        }
+        positive_.merge(other.positive_);
+        negative_.merge(other.negative_);
+        zero_count_ += other.zero_count_;
+        count_ += other.count_;
+        sum_ += other.sum_;
+        if (other.min_ < min_) {
+            min_ = other.min_;
+        }
+        if (other.max_ > max_) {
+            max_ = other.max_;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Returns the q-quantile (q in [0, 1]), or 0 if empty.
+     */
+    MYSTIC_NODISCARD double quantile(double q) const {
+        if (count_ == 0) {
+            return 0.0;
+        }
+        q = q < 0.0 ? 0.0 : q > 1.0 ? 1.0 : q;
+        const double rank = q * static_cast<double>(count_ - 1);
+
+        double result = 0.0;
+        double cumulative = 0.0;
+        bool found = false;
+        // Most negative first: highest index of the negative store.
+        negative_.forEach(false, [&](::mystic::types::int32_t bin, ::mystic::types::uint64_t n) {
+            cumulative += static_cast<double>(n);
+            if (cumulative > rank) {
+                result = -value(bin);
+                found = true;
+            }
+            return !found;
+        });
+        if (!found) {
+            cumulative += static_cast<double>(zero_count_);
+            found = cumulative > rank;
+        }
+        if (!found) {
+            positive_.forEach(true, [&](::mystic::types::int32_t bin, ::mystic::types::uint64_t n) {
+                cumulative += static_cast<double>(n);
+                if (cumulative > rank) {
+                    result = value(bin);
+                    found = true;
+                }
+                return !found;
+            });
+        }
+        if (!found) {
+            result = max_;
+        }
+        return result < min_ ? min_ : result > max_ ? max_ : result;
+    }
+
+    /**
+     * @brief Removes every value.
+     */
+    void clear() noexcept {
+        positive_.clear();
+        negative_.clear();
+        zero_count_ = 0;
+        count_ = 0;
+        sum_ = 0.0;
+        min_ = std::numeric_limits<double>::infinity();
+        max_ = -std::numeric_limits<double>::infinity();
+    }
+
+    MYSTIC_NODISCARD ::mystic::types::uint64_t count() const noexcept { return count_; }
+    MYSTIC_NODISCARD bool empty() const noexcept { return count_ == 0; }
+    MYSTIC_NODISCARD double sum() const noexcept { return sum_; }
+
+    /**
+     * @brief Returns the exact smallest value, or +infinity if empty.
+     */
+    MYSTIC_NODISCARD double min() const noexcept { return min_; }
+
+    /**
+     * @brief Returns the exact largest value, or -infinity if empty.
+     */
+    MYSTIC_NODISCARD double max() const noexcept { return max_; }
+
+    MYSTIC_NODISCARD double relative_accuracy() const noexcept { return relative_accuracy_; }
+
+    /**
+     * @brief Returns the number of bins allocated.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t bin_count() const noexcept {
+        return positive_.binCount() + negative_.binCount();
+    }
+
+private:
+    MYSTIC_FORCEINLINE ::mystic::types::int32_t index(double magnitude) const noexcept {
+        return static_cast<::mystic::types::int32_t>(std::ceil(std::log(magnitude) * multiplier_));
+    }
+
+    /**
+     * @brief Returns the estimate of bin, within relative_accuracy_ of
+     * every value it holds.
+     */
+    double value(::mystic::types::int32_t bin) const noexcept {
+        return 2.0 * std::pow(gamma_, bin) / (gamma_ + 1.0);
+    }
+
+    double relative_accuracy_ = 0.01;
+    double gamma_ = 1.0;
+    double multiplier_ = 1.0;
+    double min_indexable_ = 0.0;
+
+    internal::CollapsingDenseStore positive_;
+    internal::CollapsingDenseStore negative_;
+    ::mystic::types::uint64_t zero_count_ = 0;
+
+    ::mystic::types::uint64_t count_ = 0;
+    double sum_ = 0.0;
+    double min_ = std::numeric_limits<double>::infinity();
+    double max_ = -std::numeric_limits<double>::infinity();
+
+}; // class ddsketch
+
+} // namespace metrics
+} // namespace mystic
@@ -0,0 +1,394 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/hdr_histogram.hpp
+ * @file hdr_histogram.hpp
+ * @brief Defines high dynamic range (HDR) histogram.
+ *
+ * @details
+ * This header provides `hdr_histogram`, G. Tene's log-linear histogram:
+ * values are bucketed by power of two, and each power of two is split
+ * linearly into enough sub-buckets to keep the configured number of
+ * significant decimal digits. Tracking 1 ns to 1 hour with 3 digits
+ * takes about 33K counters (264 KB), whatever the number of samples.
+ *
+ * 1. `record()` is wait-free, one index computation (a count of leading
+ *    zeros and a shift) and one relaxed `fetch_add`. Threads may share an
+ *    instance, or keep one each and `merge()` them.
+ * 2. Queries scan the counters once, `value_at_percentiles()` answers a
+ *    sorted list of percentiles in the same pass.
+ *
+ * Queries running concurrently with `record()` see some recent records
+ * and not others, but never a torn counter.
+ *
+ * @code{.cpp}
+ * #include "mystic/metrics/hdr_histogram.hpp"
+ *
+ * // 1 ns to 60 s, 3 significant digits
+ * mystic::metrics::hdr_histogram latency(1, 60'000'000'000, 3);
+ *
+ * latency.record(elapsed_ns);
+ *
+ * uint64_t p99 = latency.value_at_percentile(99.0);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/metrics/internal/bits.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::metrics
+ * @brief Metrics, histograms and sketches.
+ */
+namespace metrics {
+
+/**
+ * @brief Log-linear histogram with bounded relative error.
+ */
+class hdr_histogram {
+public:
+    using value_type = ::mystic::types::uint64_t;
+    using count_type = ::mystic::types::uint64_t;
+
+    /**
+     * @brief Constructs a histogram tracking values from lowest to highest,
+     * with significant_digits decimal digits of precision.
+     *
+     * @param lowest The smallest value told apart from 0 (at least 1).
+     *               Lowered to 2^(63 - m) if above it, where 2^m is the
+     *               number of sub-buckets (m = 11 for 3 digits), so that
+     *               the layout fits in 64 bits.
+     * @param highest The largest value recorded (at least 2 * lowest).
+     * @param significant_digits The precision, clamped to 1 through 5.
+     */
+    hdr_histogram(value_type lowest, value_type highest,
+                  ::mystic::types::uint32_t significant_digits) {
+        if (lowest == 0) {
+            lowest = 1;
+        }
+        significant_digits =
+            significant_digits < 1 ? 1 : significant_digits > 5 ? 5 : significant_digits;
+
+        value_type largest_exact = 2;
+        for (::mystic::types::uint32_t digit = 0; digit < significant_digits; ++digit) {
+            largest_exact *= 10;
+        }
+        sub_bucket_count_magnitude_ = 64 - internal::leadingZeros(largest_exact - 1);
+        sub_bucket_half_count_magnitude_ = sub_bucket_count_magnitude_ - 1;
+        sub_bucket_count_ = ::mystic::types::uint32_t{1} << sub_bucket_count_magnitude_;
+        sub_bucket_half_count_ = sub_bucket_count_ / 2;
+        unit_magnitude_ = 63 - internal::leadingZeros(lowest);
+        // The top sub-bucket of bucket 0, shifted by the unit, must fit.
+        if (unit_magnitude_ + sub_bucket_count_magnitude_ > 63) {
+            unit_magnitude_ = 63 - sub_bucket_count_magnitude_;
+            lowest = value_type{1} << unit_magnitude_;
+        }
+        if (highest < lowest || highest - lowest < lowest) {
+            highest = lowest > (~value_type{0} >> 1) ? ~value_type{0} : 2 * lowest;
+        }
+        sub_bucket_mask_ = static_cast<value_type>(sub_bucket_count_ - 1) << unit_magnitude_;
+
+        value_type smallest_untrackable = static_cast<value_type>(sub_bucket_count_)
+                                          << unit_magnitude_;
+        bucket_count_ = 1;
+        while (smallest_untrackable <= highest) {
+            if (smallest_untrackable > (~value_type{0} >> 1)) {
+                ++bucket_count_;
+                break;
+            }
+            smallest_untrackable <<= 1;
+            ++bucket_count_;
+        }
+
+        lowest_ = lowest;
+        highest_ = highest;
+        significant_digits_ = significant_digits;
+        counts_length_ = static_cast<::mystic::types::size_t>(bucket_count_ + 1) *
+                         sub_bucket_half_count_;
+        counts_ = std::make_unique<std::atomic<count_type>[]>(counts_length_);
+    }
+
+    hdr_histogram(const hdr_histogram&) = delete;
+    hdr_histogram& operator=(const hdr_histogram&) = delete;
+
+    /**
+     * @brief Records count occurrences of value. Wait-free.
+     *
+     * @returns False (recording nothing) if value is above highest().
+     */
+    MYSTIC_FORCEINLINE bool record(value_type value, count_type count = 1) noexcept {
+        if (MYSTIC_UNLIKELY(value > highest_)) {
+            return false;
+        }
+        counts_[countsIndex(value)].fetch_add(count, std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @brief Adds every count of other, which may have another layout.
+     *
+     * @returns False if some of other's values are above highest(), those
+     * are left out.
+     */
+    bool merge(const hdr_histogram& other) noexcept {
+        if (sameLayout(other)) {
+            for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+                const count_type count = other.counts_[index].load(std::memory_order_relaxed);
+                if (count != 0) {
+                    counts_[index].fetch_add(count, std::memory_order_relaxed);
+                }
+            }
+            return true;
+        }
+        bool complete = true;
+        for (::mystic::types::size_t index = 0; index < other.counts_length_; ++index) {
+            const count_type count = other.counts_[index].load(std::memory_order_relaxed);
+            if (count != 0) {
+                complete &= record(other.medianEquivalent(other.valueFromIndex(index)), count);
+            }
+        }
+        return complete;
+    }
+
+    /**
+     * @brief Clears every count (not atomic with concurrent records).
+     */
+    void reset() noexcept {
+        for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+            counts_[index].store(0, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the number of recorded values.
+     */
+    MYSTIC_NODISCARD count_type count() const noexcept {
+        count_type total = 0;
+        for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+            total += counts_[index].load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    /**
+     * @brief Returns the smallest recorded value (to the histogram's
+     * precision), or 0 if empty.
+     */
+    MYSTIC_NODISCARD value_type min() const noexcept {
+        for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+            if (counts_[index].load(std::memory_order_relaxed) != 0) {
+                return lowestEquivalent(valueFromIndex(index));
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Returns the largest recorded value (to the histogram's
+     * precision), or 0 if empty.
+     */
+    MYSTIC_NODISCARD value_type max() const noexcept {
+        for (::mystic::types::size_t index = counts_length_; index-- > 0;) {
+            if (counts_[index].load(std::memory_order_relaxed) != 0) {
+                return highestEquivalent(valueFromIndex(index));
+            }
+        }
+        return 0;
+    }
+
+    /**
+     * @brief Returns the mean of the recorded values, or 0 if empty.
+     */
+    MYSTIC_NODISCARD double mean() const noexcept {
+        double sum = 0.0;
+        count_type total = 0;
+        for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+            const count_type count = counts_[index].load(std::memory_order_relaxed);
+            if (count != 0) {
+                sum += static_cast<double>(count) *
+                       static_cast<double>(medianEquivalent(valueFromIndex(index)));
+                total += count;
+            }
+        }
+        return total == 0 ? 0.0 : sum / static_cast<double>(total);
+    }
+
+    /**
+     * @brief Returns the value below which percentile percent of the
+     * recorded values fall, or 0 if empty.
+     */
+    MYSTIC_NODISCARD value_type value_at_percentile(double percentile) const noexcept {
+        value_type value = 0;
+        value_at_percentiles(&percentile, &value, 1);
+        return value;
+    }
+
+    /**
+     * @brief Computes several percentiles in one pass.
+     *
+     * @param percentiles The percentiles, in ascending order.
+     * @param values Receives one value per percentile.
+     * @param size The number of percentiles.
+     */
+    void value_at_percentiles(const double* percentiles, value_type* values,
+                              ::mystic::types::size_t size) const noexcept {
+        const count_type total = count();
+        ::mystic::types::size_t next = 0;
+        if (total != 0) {
+            count_type cumulative = 0;
+            for (::mystic::types::size_t index = 0; index < counts_length_ && next < size;
+                 ++index) {
+                cumulative += counts_[index].load(std::memory_order_relaxed);
+                while (next < size && cumulative >= rank(percentiles[next], total)) {
+                    values[next++] = highestEquivalent(valueFromIndex(index));
+                }
+            }
+        }
+        for (; next < size; ++next) {
+            values[next] = total == 0 ? 0 : max();
+        }
+    }
+
+    /**
+     * @brief Calls fn(lowest, highest, count) for every non-empty bucket,
+     * in ascending order.
+     */
+    template <typename Function>
+    void for_each_bucket(Function&& fn) const {
+        for (::mystic::types::size_t index = 0; index < counts_length_; ++index) {
+            const count_type count = counts_[index].load(std::memory_order_relaxed);
+            if (count != 0) {
+                const value_type value = valueFromIndex(index);
+                fn(lowestEquivalent(value), highestEquivalent(value), count);
+            }
+        }
+    }
+
+    MYSTIC_NODISCARD value_type lowest() const noexcept { return lowest_; }
+    MYSTIC_NODISCARD value_type highest() const noexcept { return highest_; }
+    MYSTIC_NODISCARD ::mystic::types::uint32_t significant_digits() const noexcept {
+        return significant_digits_;
+    }
+
+    /**
+     * @brief Returns the memory used by the counters, in bytes.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t memory_size() const noexcept {
+        return counts_length_ * sizeof(std::atomic<count_type>);
+    }
+
+private:
+    MYSTIC_FORCEINLINE ::mystic::types::size_t countsIndex(value_type value) const noexcept {
+        const ::mystic::types::uint32_t bucket =
+            (64 - internal::leadingZeros(value | sub_bucket_mask_)) -
+            (unit_magnitude_ + sub_bucket_half_count_magnitude_ + 1);
+        const auto sub_bucket =
+            static_cast<::mystic::types::uint32_t>(value >> (bucket + unit_magnitude_));
+        // Bucket 0 uses its lower half too, so sub_bucket may be below half.
+        return (static_cast<::mystic::types::size_t>(bucket + 1)
+                << sub_bucket_half_count_magnitude_) +
+               sub_bucket - sub_bucket_half_count_;
+    }
+
+    value_type valueFromIndex(::mystic::types::size_t index) const noexcept {
+        auto bucket = static_cast<::mystic::types::int32_t>(index >> sub_bucket_half_count_magnitude_) - 1;
+        auto sub_bucket = static_cast<::mystic::types::uint32_t>(
+                              index & (sub_bucket_half_count_ - 1)) +
+                          sub_bucket_half_count_;
+        if (bucket < 0) {
+            sub_bucket -= sub_bucket_half_count_;
+            bucket = 0;
+        }
+        return static_cast<value_type>(sub_bucket)
+               << (static_cast<::mystic::types::uint32_t>(bucket) + unit_magnitude_);
+    }
+
+    value_type equivalentRange(value_type value) const noexcept {
+        const ::mystic::types::uint32_t bucket =
+            (64 - internal::leadingZeros(value | sub_bucket_mask_)) -
+            (unit_magnitude_ + sub_bucket_half_count_magnitude_ + 1);
+        const auto sub_bucket =
+            static_cast<::mystic::types::uint32_t>(value >> (bucket + unit_magnitude_));
+        const ::mystic::types::uint32_t adjusted =
+            sub_bucket >= sub_bucket_count_ ? bucket + 1 : bucket;
+        return value_type{1} << (unit_magnitude_ + adjusted);
+    }
+
+    value_type lowestEquivalent(value_type value) const noexcept {
+        const value_type range = equivalentRange(value);
+        return value & ~(range - 1);
+    }
+
+    value_type highestEquivalent(value_type value) const noexcept {
+        return lowestEquivalent(value) + equivalentRange(value) - 1;
+    }
+
+    value_type medianEquivalent(value_type value) const noexcept {
+        return lowestEquivalent(value) + equivalentRange(value) / 2;
+    }
+
+    static count_type rank(double percentile, count_type total) noexcept {
+        const double clamped = percentile < 0.0 ? 0.0 : percentile > 100.0 ? 100.0 : percentile;
+        const auto ranked =
+            static_cast<count_type>(clamped / 100.0 * static_cast<double>(total) + 0.5);
+        return ranked < 1 ? 1 : ranked;
+    }
+
+    bool sameLayout(const hdr_histogram& other) const noexcept {
+        return unit_magnitude_ == other.unit_magnitude_ &&
+               sub_bucket_count_ == other.sub_bucket_count_ &&
+               counts_length_ == other.counts_length_;
+    }
+
+    value_type lowest_ = 1;
+    value_type highest_ = 2;
+    ::mystic::types::uint32_t significant_digits_ = 1;
+
+    /// Layout, as in the reference implementation
+    ::mystic::types::uint32_t unit_magnitude_ = 0;
+    ::mystic::types::uint32_t sub_bucket_count_magnitude_ = 0;
+    ::mystic::types::uint32_t sub_bucket_half_count_magnitude_ = 0;
+    ::mystic::types::uint32_t sub_bucket_count_ = 0;
+    ::mystic::types::uint32_t sub_bucket_half_count_ = 0;
+    ::mystic::types::uint32_t bucket_count_ = 0;
+    value_type sub_bucket_mask_ = 0;
+
+    /// Counters
+    ::mystic::types::size_t counts_length_ = 0;
+    std::unique_ptr<std::atomic<count_type>[]> counts_;
+
+}; // class hdr_histogram
+
+} // namespace metrics
+} // namespace mystic
@@ -0,0 +1,58 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/internal/bits.hpp
+ * @file bits.hpp
+ * @brief Bit manipulation helpers shared by histograms and sketches.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic::metrics::internal
+ * @brief Internal implementation details of metrics.
+ *
+ * @details
+ * This namespace contains internal implementation details of metrics.
+ * **It should not be used directly.**
+ */
+namespace mystic::metrics::internal {
+
+/**
+ * @brief Returns the number of leading zero bits of a non-zero value.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::uint32_t leadingZeros(::mystic::types::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<::mystic::types::uint32_t>(__builtin_clzll(value));
+#else
+    ::mystic::types::uint32_t count = 0;
+    for (::mystic::types::uint64_t bit = ::mystic::types::uint64_t{1} << 63; (value & bit) == 0;
+         bit >>= 1) {
+        ++count;
+    }
+    return count;
+#endif
+}
+
+} // namespace mystic::metrics::internal
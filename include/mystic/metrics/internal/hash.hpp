@@ -0,0 +1,107 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/internal/hash.hpp
+ * @file hash.hpp
+ * @brief 64-bit hashing for probabilistic sketches.
+ *
+ * @details
+ * Sketches need every bit of a hash to be uniform, which `std::hash`
+ * does not promise (it is the identity for integers in libstdc++).
+ * Integers go through the MurmurHash3 64-bit finalizer, byte strings are
+ * folded 8 bytes at a time with multiply-xorshift rounds, then finalized.
+ * The hashes are stable across runs and platforms of the same endianness,
+ * so sketches built in different processes can be merged.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::metrics::internal {
+
+/**
+ * @brief MurmurHash3 64-bit finalizer, a bijection with full avalanche.
+ */
+MYSTIC_FORCEINLINE constexpr ::mystic::types::uint64_t mix64(::mystic::types::uint64_t value) noexcept {
+    value ^= value >> 33;
+    value *= 0xFF51AFD7ED558CCDull;
+    value ^= value >> 33;
+    value *= 0xC4CEB9FE1A85EC53ull;
+    value ^= value >> 33;
+    return value;
+}
+
+/**
+ * @brief Hashes size bytes at data.
+ */
+inline ::mystic::types::uint64_t hashBytes(const void* data, ::mystic::types::size_t size,
+                                           ::mystic::types::uint64_t seed = 0) noexcept {
+    constexpr ::mystic::types::uint64_t kMultiplier = 0x9E3779B97F4A7C15ull;
+    const auto* bytes = static_cast<const unsigned char*>(data);
+    ::mystic::types::uint64_t hash = seed ^ (size * kMultiplier);
+
+    while (size >= 8) {
+        ::mystic::types::uint64_t chunk;
+        std::memcpy(&chunk, bytes, 8);
+        hash = (hash ^ mix64(chunk)) * kMultiplier;
+        hash ^= hash >> 29;
+        bytes += 8;
+        size -= 8;
+    }
+    if (size != 0) {
+        ::mystic::types::uint64_t chunk = 0;
+        std::memcpy(&chunk, bytes, size);
+        hash = (hash ^ mix64(chunk)) * kMultiplier;
+        hash ^= hash >> 29;
+    }
+    return mix64(hash);
+}
+
+/**
+ * @brief Hash of a sketch key: integers, enums and strings.
+ */
+template <typename Key, typename = void>
+struct SketchHash;
+
+template <typename Key>
+struct SketchHash<Key, std::enable_if_t<std::is_integral_v<Key> || std::is_enum_v<Key>>> {
+    ::mystic::types::uint64_t operator()(Key key) const noexcept {
+        return mix64(static_cast<::mystic::types::uint64_t>(key));
+    }
+}; // struct SketchHash
+
+template <typename Key>
+struct SketchHash<Key, std::enable_if_t<std::is_convertible_v<const Key&, std::string_view>>> {
+    ::mystic::types::uint64_t operator()(const Key& key) const noexcept {
+        const std::string_view view(key);
+        return hashBytes(view.data(), view.size());
+    }
+}; // struct SketchHash
+
+} // namespace mystic::metrics::internal
@@ -0,0 +1,136 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/prometheus.hpp
+ * @file prometheus.hpp
+ * @brief Defines Prometheus text exposition writer.
+ *
+ * @details
+ * This header provides `write_prometheus()`, which renders a `registry`
+ * in the Prometheus text exposition format (version 0.0.4), ready to be
+ * served on a /metrics endpoint.
+ *
+ * The output goes into a caller-owned buffer, which is cleared first and
+ * keeps its capacity, so a scraper reusing one buffer stops allocating
+ * once the buffer has grown to the size of the output. Numbers are
+ * formatted with `std::to_chars`, which neither allocates nor depends on
+ * the locale.
+ *
+ * @code{.cpp}
+ * #include "mystic/metrics/prometheus.hpp"
+ *
+ * std::string page; // Reused across scrapes
+ *
+ * mystic::metrics::write_prometheus(mystic::metrics::registry::global(), page);
+ * send(page);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <charconv>
+#include <string>
+#include <string_view>
+
+#include "mystic/metrics/registry.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::metrics::internal {
+
+/**
+ * @brief Appends text, escaping backslashes and newlines as HELP requires.
+ */
+inline void appendEscapedHelp(std::string& out, std::string_view text) {
+    for (const char c : text) {
+        if (c == '\\') {
+            out.append("\\\\", 2);
+        } else if (c == '\n') {
+            out.append("\\n", 2);
+        } else {
+            out.push_back(c);
+        }
+    }
+}
+
+/**
+ * @brief Appends the decimal form of value.
+ */
+template <typename Integer>
+void appendInteger(std::string& out, Integer value) {
+    char digits[24];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, static_cast<::mystic::types::size_t>(result.ptr - digits));
+}
+
+} // namespace mystic::metrics::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::metrics
+ * @brief Metrics, histograms and sketches.
+ */
+namespace metrics {
+
+/**
+ * @brief Renders every series of metrics into out (cleared first).
+ *
+ * @returns The size of the output, in bytes.
+ */
+inline ::mystic::types::size_t write_prometheus(const registry& metrics, std::string& out) {
+    out.clear();
+    metrics.for_each([&out](const metric_sample& sample) {
+        if (sample.family_start) {
+            if (!sample.help.empty()) {
+                out.append("# HELP ");
+                out.append(sample.name);
+                out.push_back(' ');
+                internal::appendEscapedHelp(out, sample.help);
+                out.push_back('\n');
+            }
+            out.append("# TYPE ");
+            out.append(sample.name);
+            out.append(sample.type == metric_type::counter ? " counter\n" : " gauge\n");
+        }
+        out.append(sample.name);
+        if (!sample.labels.empty()) {
+            out.push_back('{');
+            out.append(sample.labels);
+            out.push_back('}');
+        }
+        out.push_back(' ');
+        if (sample.type == metric_type::counter) {
+            internal::appendInteger(out, sample.counter);
+        } else {
+            internal::appendInteger(out, sample.gauge);
+        }
+        out.push_back('\n');
+    });
+    return out.size();
+}
+
+} // namespace metrics
+} // namespace mystic
@@ -0,0 +1,433 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/metrics/registry.hpp
+ * @file registry.hpp
+ * @brief Defines registry of named counters and gauges.
+ *
+ * @details
+ * This header provides `registry`, where counters and gauges are
+ * registered once by name (and label set), and updated through handles.
+ *
+ * 1. Registration takes a lock and allocates, and returns a handle, a
+ *    pointer to storage which never moves. Registering the same name and
+ *    labels again returns the same series.
+ * 2. An update through a handle is a single relaxed atomic operation on
+ *    the series' own cache line, or, for counters registered with
+ *    `counter_mode::per_cpu`, an increment of a
+ *    `mystic::concurrency::sharded_counter`. It never locks or allocates.
+ * 3. `for_each()` and `snapshot()` visit every series, in registration
+ *    order, grouped by family. Registration waits while they run, so the
+ *    set of series is consistent, and each value is read exactly once.
+ *
+ * Names follow the Prometheus data model ([a-zA-Z_:][a-zA-Z0-9_:]*), and
+ * labels are given preformatted (`method="GET",code="200"`). See
+ * `prometheus.hpp` for the text exposition writer.
+ *
+ * @code{.cpp}
+ * #include "mystic/metrics/registry.hpp"
+ *
+ * auto& metrics = mystic::metrics::registry::global();
+ *
+ * // Once
+ * auto requests = metrics.register_counter("http_requests_total", "Requests served.",
+ *                                          "method=\"GET\"");
+ *
+ * // Every request
+ * requests->increment();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/mutex.hpp"
+#include "mystic/concurrency/sharded_counter.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/status/status_or.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::metrics
+ * @brief Metrics, histograms and sketches.
+ */
+namespace metrics {
+
+/**
+ * @brief Kind of a registered metric.
+ */
+enum class metric_type : ::mystic::types::uint8_t {
+    /// Monotonic count
+    counter,
+
+    /// Value which can go up and down
+    gauge,
+}; // enum class metric_type
+
+/**
+ * @brief Storage of a counter.
+ */
+enum class counter_mode : ::mystic::types::uint8_t {
+    /// One atomic, for counters updated from a few threads at a time
+    atomic,
+
+    /// One slot per CPU, for counters hammered from every core
+    per_cpu,
+}; // enum class counter_mode
+
+/**
+ * @brief One series read by a registry visit.
+ */
+struct metric_sample {
+    std::string_view name;
+    std::string_view help;
+
+    /// Preformatted labels, without braces, empty if none
+    std::string_view labels;
+
+    metric_type type = metric_type::counter;
+
+    /// True for the first series of its family
+    bool family_start = false;
+
+    /// Value of a counter
+    ::mystic::types::uint64_t counter = 0;
+
+    /// Value of a gauge
+    ::mystic::types::int64_t gauge = 0;
+}; // struct metric_sample
+
+} // namespace metrics
+} // namespace mystic
+
+namespace mystic::metrics::internal {
+
+/**
+ * @brief Storage of one series, on its own cache line.
+ */
+struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) MetricSeries {
+    /// Counter value (counter_mode::atomic), or gauge bits
+    std::atomic<::mystic::types::uint64_t> value{0};
+
+    /// Counter value (counter_mode::per_cpu), null otherwise
+    std::unique_ptr<::mystic::concurrency::sharded_counter> sharded;
+
+    std::string labels;
+}; // struct MetricSeries
+
+/**
+ * @brief Series sharing a name, help and type.
+ */
+struct MetricFamily {
+    std::string name;
+    std::string help;
+    metric_type type;
+    std::vector<std::unique_ptr<MetricSeries>> series;
+}; // struct MetricFamily
+
+/**
+ * @brief Returns true if name is a valid Prometheus metric name.
+ */
+inline bool isValidMetricName(std::string_view name) noexcept {
+    if (name.empty()) {
+        return false;
+    }
+    for (::mystic::types::size_t position = 0; position < name.size(); ++position) {
+        const char c = name[position];
+        const bool alpha = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_' || c == ':';
+        if (!alpha && (position == 0 || c < '0' || c > '9')) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Returns true if labels can be embedded between braces.
+ */
+inline bool isValidLabelSet(std::string_view labels) noexcept {
+    return labels.find_first_of("{}\n") == std::string_view::npos;
+}
+
+} // namespace mystic::metrics::internal
+
+namespace mystic {
+namespace metrics {
+
+/**
+ * @brief Handle of a registered counter.
+ */
+class counter {
+public:
+    /**
+     * @brief Adds value to the counter.
+     */
+    MYSTIC_FORCEINLINE void add(::mystic::types::uint64_t value) noexcept {
+        if (MYSTIC_LIKELY(series_->sharded == nullptr)) {
+            series_->value.fetch_add(value, std::memory_order_relaxed);
+        } else {
+            series_->sharded->add(value);
+        }
+    }
+
+    /**
+     * @brief Adds one to the counter.
+     */
+    MYSTIC_FORCEINLINE void increment() noexcept { add(1); }
+
+    /**
+     * @brief Returns the current count.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t value() const noexcept {
+        return series_->sharded == nullptr ? series_->value.load(std::memory_order_relaxed)
+                                           : series_->sharded->read();
+    }
+
+private:
+    friend class registry;
+
+    explicit counter(internal::MetricSeries* series) noexcept : series_(series) {}
+
+    internal::MetricSeries* series_;
+
+}; // class counter
+
+/**
+ * @brief Handle of a registered gauge.
+ */
+class gauge {
+public:
+    /**
+     * @brief Sets the gauge to value.
+     */
+    MYSTIC_FORCEINLINE void set(::mystic::types::int64_t value) noexcept {
+        series_->value.store(static_cast<::mystic::types::uint64_t>(value),
+                             std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Adds delta (which may be negative) to the gauge.
+     */
+    MYSTIC_FORCEINLINE void add(::mystic::types::int64_t delta) noexcept {
+        // Two's complement wrap-around makes unsigned addition signed.
+        series_->value.fetch_add(static_cast<::mystic::types::uint64_t>(delta),
+                                 std::memory_order_relaxed);
+    }
+
+    MYSTIC_FORCEINLINE void increment() noexcept { add(1); }
+    MYSTIC_FORCEINLINE void decrement() noexcept { add(-1); }
+
+    /**
+     * @brief Returns the current value.
+     */
+    MYSTIC_NODISCARD ::mystic::types::int64_t value() const noexcept {
+        return static_cast<::mystic::types::int64_t>(
+            series_->value.load(std::memory_order_relaxed));
+    }
+
+private:
+    friend class registry;
+
+    explicit gauge(internal::MetricSeries* series) noexcept : series_(series) {}
+
+    internal::MetricSeries* series_;
+
+}; // class gauge
+
+/**
+ * @brief Registry of named counters and gauges.
+ *
+ * @note Handles point into the registry, which must outlive them.
+ */
+class registry {
+public:
+    registry() = default;
+    registry(const registry&) = delete;
+    registry& operator=(const registry&) = delete;
+
+    /**
+     * @brief Returns the process-wide registry (never destroyed, so
+     * handles stay valid during static destruction).
+     */
+    static registry& global() {
+        static registry* instance = new registry();
+        return *instance;
+    }
+
+    /**
+     * @brief Registers a counter, or returns the one registered under the
+     * same name and labels (keeping the mode it was created with).
+     *
+     * @returns INVALID_ARGUMENT if name or labels are malformed,
+     *          ALREADY_EXISTS if name is registered as another type.
+     */
+    status::StatusOr<counter> register_counter(std::string_view name, std::string_view help,
+                                               std::string_view labels = {},
+                                               counter_mode mode = counter_mode::atomic) {
+        internal::MetricSeries* series = nullptr;
+        const status::StatusCode code =
+            findOrCreate(name, help, labels, metric_type::counter, mode, series);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+        return counter(series);
+    }
+
+    /**
+     * @brief Registers a gauge, or returns the one registered under the
+     * same name and labels.
+     *
+     * @returns INVALID_ARGUMENT if name or labels are malformed,
+     *          ALREADY_EXISTS if name is registered as another type.
+     */
+    status::StatusOr<gauge> register_gauge(std::string_view name, std::string_view help,
+                                           std::string_view labels = {}) {
+        internal::MetricSeries* series = nullptr;
+        const status::StatusCode code =
+            findOrCreate(name, help, labels, metric_type::gauge, counter_mode::atomic, series);
+        if (code != status::StatusCode::OK) {
+            return code;
+        }
+        return gauge(series);
+    }
+
+    /**
+     * @brief Calls fn(const metric_sample&) for every series, in
+     * registration order, grouped by family. Registration waits meanwhile.
+     */
+    template <typename Function>
+    void for_each(Function&& fn) const {
+        std::lock_guard<::mystic::concurrency::mutex> lock(mutex_);
+        for (const auto& family : families_) {
+            metric_sample sample;
+            sample.name = family->name;
+            sample.help = family->help;
+            sample.type = family->type;
+            sample.family_start = true;
+            for (const auto& series : family->series) {
+                sample.labels = series->labels;
+                if (family->type == metric_type::counter) {
+                    sample.counter = series->sharded == nullptr
+                                         ? series->value.load(std::memory_order_relaxed)
+                                         : series->sharded->read();
+                } else {
+                    sample.gauge = static_cast<::mystic::types::int64_t>(
+                        series->value.load(std::memory_order_relaxed));
+                }
+                fn(static_cast<const metric_sample&>(sample));
+                sample.family_start = false;
+            }
+        }
+    }
+
+    /**
+     * @brief Replaces out with every series. Reusing out avoids allocating
+     * once its capacity suffices, the views stay valid as long as the
+     * registry.
+     */
+    void snapshot(std::vector<metric_sample>& out) const {
+        out.clear();
+        for_each([&out](const metric_sample& sample) { out.push_back(sample); });
+    }
+
+    /**
+     * @brief Returns the number of registered series.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t size() const {
+        std::lock_guard<::mystic::concurrency::mutex> lock(mutex_);
+        return series_count_;
+    }
+
+private:
+    status::StatusCode findOrCreate(std::string_view name, std::string_view help,
+                                    std::string_view labels, metric_type type, counter_mode mode,
+                                    internal::MetricSeries*& series) {
+        if (!internal::isValidMetricName(name) || !internal::isValidLabelSet(labels)) {
+            return status::StatusCode::INVALID_ARGUMENT;
+        }
+
+        std::lock_guard<::mystic::concurrency::mutex> lock(mutex_);
+        internal::MetricFamily* family = nullptr;
+        const auto found = by_name_.find(std::string(name));
+        if (found != by_name_.end()) {
+            family = found->second;
+            if (family->type != type) {
+                return status::StatusCode::ALREADY_EXISTS;
+            }
+            for (const auto& existing : family->series) {
+                if (existing->labels == labels) {
+                    series = existing.get();
+                    return status::StatusCode::OK;
+                }
+            }
+        } else {
+            auto created = std::make_unique<internal::MetricFamily>();
+            created->name = std::string(name);
+            created->help = std::string(help);
+            created->type = type;
+            family = created.get();
+            families_.push_back(std::move(created));
+            by_name_.emplace(family->name, family);
+        }
+
+        auto created = std::make_unique<internal::MetricSeries>();
+        created->labels = std::string(labels);
+        if (mode == counter_mode::per_cpu) {
+            // Set before the handle exists, handles read it without the lock.
+            created->sharded = std::make_unique<::mystic::concurrency::sharded_counter>();
+        }
+        series = created.get();
+        family->series.push_back(std::move(created));
+        ++series_count_;
+        return status::StatusCode::OK;
+    }
+
+    /// Guards the structure (never the values)
+    mutable ::mystic::concurrency::mutex mutex_;
+
+    /// Families, in registration order
+    std::vector<std::unique_ptr<internal::MetricFamily>> families_;
+
+    /// Families, by name
+    std::unordered_map<std::string, internal::MetricFamily*> by_name_;
+
+    ::mystic::types::size_t series_count_ = 0;
+
+}; // class registry
+
+} // namespace metrics
+} // namespace mystic
@@ -0,0 +1,233 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/platform/futex.hpp
+ * @file futex.hpp
+ * @brief Defines portable wait/wake on a 32-bit word.
+ *
+ * @details
+ * This header provides `futex_wait()` and `futex_wake()`, which block a
+ * thread while a 32-bit atomic word holds an expected value, and wake
+ * threads blocked on it. The backend is selected by `MYSTIC_ARCH_OS`:
+ *
+ * 1. Linux uses the `futex` syscall (private futexes).
+ * 2. Windows uses `WaitOnAddress()` / `WakeByAddress*()`.
+ * 3. Everything else uses an emulation, a hashed table of mutexes and
+ *    condition variables.
+ *
+ * Waits may return spuriously, callers must re-check the word in a loop.
+ * Waking with nobody waiting still costs a syscall on Linux and Windows,
+ * so callers should track waiters, and only wake when needed.
+ *
+ * @code{.cpp}
+ * #include "mystic/platform/futex.hpp"
+ *
+ * std::atomic<uint32_t> ready{0};
+ *
+ * // Waiter
+ * while (ready.load(std::memory_order_acquire) == 0) {
+ *     mystic::platform::futex_wait(ready, 0);
+ * }
+ *
+ * // Waker
+ * ready.store(1, std::memory_order_release);
+ * mystic::platform::futex_wake_all(ready);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <climits>
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <time.h>
+# include <unistd.h>
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+// Keep min / max macros and rarely used APIs out of every includer.
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# include <windows.h>
+# if defined(_MSC_VER)
+#  pragma comment(lib, "Synchronization.lib")
+# endif
+#else
+# include <condition_variable>
+# include <mutex>
+#endif
+
+namespace mystic::platform::internal {
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+
+/**
+ * @brief Issues a futex syscall on word.
+ */
+inline long futexCall(const std::atomic<::mystic::types::uint32_t>& word, int operation,
+                      ::mystic::types::uint32_t value, const struct timespec* timeout) noexcept {
+    static_assert(sizeof(std::atomic<::mystic::types::uint32_t>) == 4,
+                  "futex requires a lock-free 32-bit atomic.");
+    return ::syscall(SYS_futex, reinterpret_cast<const ::mystic::types::uint32_t*>(&word),
+                     operation, value, timeout, nullptr, 0);
+}
+
+#elif (MYSTIC_ARCH_OS != MYSTIC_ARCH_OS_WINDOWS)
+
+/**
+ * @brief One bucket of the emulated futex table.
+ */
+struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) FutexBucket {
+    std::mutex mutex;
+    std::condition_variable signal;
+}; // struct FutexBucket
+
+/// Number of buckets in the emulated futex table (a power of two).
+inline constexpr ::mystic::types::size_t kFutexBucketCount = 64;
+
+/**
+ * @brief Returns the bucket of address.
+ */
+inline FutexBucket& futexBucket(const void* address) noexcept {
+    static FutexBucket buckets[kFutexBucketCount];
+    const auto key = reinterpret_cast<::mystic::types::uintptr_t>(address);
+    const ::mystic::types::uint64_t hash =
+        static_cast<::mystic::types::uint64_t>(key) * 0x9E3779B97F4A7C15ull;
+    return buckets[(hash >> 32) & (kFutexBucketCount - 1)];
+}
+
+#endif
+
+} // namespace mystic::platform::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::platform
+ * @brief Operating system abstractions.
+ */
+namespace platform {
+
+/**
+ * @brief Blocks while word holds expected, until woken. May wake spuriously.
+ */
+inline void futex_wait(const std::atomic<::mystic::types::uint32_t>& word,
+                       ::mystic::types::uint32_t expected) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    internal::futexCall(word, FUTEX_WAIT_PRIVATE, expected, nullptr);
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    ::WaitOnAddress(const_cast<std::atomic<::mystic::types::uint32_t>*>(&word), &expected,
+                    sizeof(expected), INFINITE);
+#else
+    internal::FutexBucket& bucket = internal::futexBucket(&word);
+    std::unique_lock<std::mutex> lock(bucket.mutex);
+    if (word.load(std::memory_order_relaxed) == expected) {
+        bucket.signal.wait(lock);
+    }
+#endif
+}
+
+/**
+ * @brief Blocks while word holds expected, until woken or deadline.
+ * May wake spuriously.
+ *
+ * @returns False if the deadline passed.
+ */
+inline bool futex_wait_until(const std::atomic<::mystic::types::uint32_t>& word,
+                             ::mystic::types::uint32_t expected,
+                             std::chrono::steady_clock::time_point deadline) noexcept {
+    const auto remaining = deadline - std::chrono::steady_clock::now();
+    if (remaining <= std::chrono::steady_clock::duration::zero()) {
+        return false;
+    }
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    const auto nanos = std::chrono::duration_cast<std::chrono::nanoseconds>(remaining).count();
+    struct timespec timeout;
+    timeout.tv_sec = static_cast<time_t>(nanos / 1000000000);
+    timeout.tv_nsec = static_cast<long>(nanos % 1000000000);
+    internal::futexCall(word, FUTEX_WAIT_PRIVATE, expected, &timeout);
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    // Round up, so the wait never returns before the deadline. Longer
+    // waits are capped below INFINITE, the caller re-waits on return.
+    auto millis = std::chrono::ceil<std::chrono::milliseconds>(remaining).count();
+    if (millis > static_cast<decltype(millis)>(INFINITE - 1)) {
+        millis = static_cast<decltype(millis)>(INFINITE - 1);
+    }
+    ::WaitOnAddress(const_cast<std::atomic<::mystic::types::uint32_t>*>(&word), &expected,
+                    sizeof(expected), static_cast<DWORD>(millis));
+#else
+    internal::FutexBucket& bucket = internal::futexBucket(&word);
+    std::unique_lock<std::mutex> lock(bucket.mutex);
+    if (word.load(std::memory_order_relaxed) == expected) {
+        bucket.signal.wait_until(lock, deadline);
+    }
+#endif
+    return std::chrono::steady_clock::now() < deadline;
+}
+
+/**
+ * @brief Wakes at most one thread blocked on word.
+ */
+inline void futex_wake_one(const std::atomic<::mystic::types::uint32_t>& word) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    internal::futexCall(word, FUTEX_WAKE_PRIVATE, 1, nullptr);
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    ::WakeByAddressSingle(const_cast<std::atomic<::mystic::types::uint32_t>*>(&word));
+#else
+    // Buckets are shared between addresses, so wake everyone in the bucket.
+    internal::FutexBucket& bucket = internal::futexBucket(&word);
+    std::lock_guard<std::mutex> lock(bucket.mutex);
+    bucket.signal.notify_all();
+#endif
+}
+
+/**
+ * @brief Wakes every thread blocked on word.
+ */
+inline void futex_wake_all(const std::atomic<::mystic::types::uint32_t>& word) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    internal::futexCall(word, FUTEX_WAKE_PRIVATE, INT_MAX, nullptr);
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    ::WakeByAddressAll(const_cast<std::atomic<::mystic::types::uint32_t>*>(&word));
+#else
+    internal::FutexBucket& bucket = internal::futexBucket(&word);
+    std::lock_guard<std::mutex> lock(bucket.mutex);
+    bucket.signal.notify_all();
+#endif
+}
+
+} // namespace platform
+} // namespace mystic
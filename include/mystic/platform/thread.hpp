@@ -0,0 +1,275 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/platform/thread.hpp
+ * @file thread.hpp
+ * @brief Defines thread identity, registry, naming and scheduling helpers.
+ *
+ * @details
+ * This header provides `mystic::platform::thread`, helpers acting on the
+ * calling thread:
+ *
+ * 1. `os_id()` returns the OS thread id (`gettid` on Linux), cached in a
+ *    thread-local after the first call.
+ * 2. `index()` returns a dense small integer, unique among live registered
+ *    threads, and reused after a thread exits, so it can index per-thread
+ *    arrays. The first call registers the thread.
+ * 3. `set_name()`, `pin_to_cpu()`, `set_affinity()`, `set_realtime()`,
+ *    `set_nice()` and `set_normal_scheduling()` wrap the OS calls, and
+ *    report failures as `mystic::status::StatusCode`, `name()` reads the
+ *    name back.
+ * 4. `for_each()` enumerates live registered threads.
+ *
+ * The identity helpers (1, 2 and 4) are defined in `thread_registry.hpp`,
+ * which does not depend on `mystic::status`.
+ *
+ * @code{.cpp}
+ * #include "mystic/platform/thread.hpp"
+ *
+ * namespace thread = mystic::platform::thread;
+ *
+ * thread::set_name("io-worker-3");
+ * thread::pin_to_cpu(3);
+ *
+ * // Hot path, no hashing of std::thread::id
+ * buffers[thread::index()].push(event);
+ *
+ * thread::for_each([](const thread::thread_info& info) {
+ *     std::printf("%zu %llu %s\n", info.index, info.os_id, info.name);
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/platform/thread_registry.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <cerrno>
+# include <pthread.h>
+# include <sched.h>
+# include <sys/resource.h>
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+# include <cerrno>
+# include <pthread.h>
+# include <sched.h>
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# include <windows.h>
+#endif
+
+namespace mystic::platform::internal {
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+
+/**
+ * @brief Maps an errno value to a StatusCode.
+ */
+inline ::mystic::status::StatusCode statusFromErrno(int error) noexcept {
+    switch (error) {
+        case 0:
+            return ::mystic::status::StatusCode::OK;
+        case EPERM:
+        case EACCES:
+            return ::mystic::status::StatusCode::PERMISSION_DENIED;
+        case EINVAL:
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        case ESRCH:
+            return ::mystic::status::StatusCode::NOT_FOUND;
+        case ERANGE:
+            return ::mystic::status::StatusCode::OUT_OF_RANGE;
+        default:
+            return ::mystic::status::StatusCode::INTERNAL;
+    }
+}
+
+#endif
+
+} // namespace mystic::platform::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::platform
+ * @brief Operating system abstractions.
+ */
+namespace platform {
+
+/**
+ * @namespace mystic::platform::thread
+ * @brief Helpers acting on the calling thread.
+ */
+namespace thread {
+
+/**
+ * @brief Registers the caller (if needed), and names it, for the OS
+ * (truncated to 15 characters) and the registry.
+ */
+inline ::mystic::status::StatusCode set_name(const char* name) {
+    internal::LocalThread& self = internal::localThread();
+    internal::ThreadRegistry::instance().rename(&self.record(), name);
+    const char* truncated = self.record().name;
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    return internal::statusFromErrno(::pthread_setname_np(::pthread_self(), truncated));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+    return internal::statusFromErrno(::pthread_setname_np(truncated));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    wchar_t wide[internal::kMaxThreadNameLength + 1] = {};
+    for (::mystic::types::size_t index = 0; truncated[index] != '\0'; ++index) {
+        wide[index] = static_cast<wchar_t>(static_cast<unsigned char>(truncated[index]));
+    }
+    return SUCCEEDED(::SetThreadDescription(::GetCurrentThread(), wide))
+               ? ::mystic::status::StatusCode::OK
+               : ::mystic::status::StatusCode::INTERNAL;
+#else
+    return ::mystic::status::StatusCode::UNIMPLEMENTED;
+#endif
+}
+
+/**
+ * @brief Returns the caller's registered name (empty until set_name()),
+ * valid until the caller exits.
+ */
+inline const char* name() {
+    // Only the caller renames its record, so it reads without the lock.
+    return internal::localThread().record().name;
+}
+
+/**
+ * @brief Restricts the caller to the given CPUs.
+ */
+inline ::mystic::status::StatusCode set_affinity(const ::mystic::types::uint32_t* cpus,
+                                                 ::mystic::types::size_t count) noexcept {
+    if (count == 0) {
+        return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+    }
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (::mystic::types::size_t index = 0; index < count; ++index) {
+        if (cpus[index] >= CPU_SETSIZE) {
+            return ::mystic::status::StatusCode::OUT_OF_RANGE;
+        }
+        CPU_SET(cpus[index], &set);
+    }
+    return internal::statusFromErrno(::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    DWORD_PTR mask = 0;
+    for (::mystic::types::size_t index = 0; index < count; ++index) {
+        if (cpus[index] >= sizeof(DWORD_PTR) * 8) {
+            return ::mystic::status::StatusCode::OUT_OF_RANGE;
+        }
+        mask |= static_cast<DWORD_PTR>(1) << cpus[index];
+    }
+    return ::SetThreadAffinityMask(::GetCurrentThread(), mask) != 0
+               ? ::mystic::status::StatusCode::OK
+               : ::mystic::status::StatusCode::INVALID_ARGUMENT;
+#else
+    // macOS only offers affinity hints (thread_policy_set), not pinning.
+    (void)cpus;
+    return ::mystic::status::StatusCode::UNIMPLEMENTED;
+#endif
+}
+
+/**
+ * @brief Pins the caller to a single CPU.
+ */
+inline ::mystic::status::StatusCode pin_to_cpu(::mystic::types::uint32_t cpu) noexcept {
+    return set_affinity(&cpu, 1);
+}
+
+/**
+ * @brief Switches the caller to real-time FIFO scheduling (SCHED_FIFO) at
+ * priority. Usually needs CAP_SYS_NICE, or an RLIMIT_RTPRIO.
+ */
+inline ::mystic::status::StatusCode set_realtime(int priority) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+    const int low = ::sched_get_priority_min(SCHED_FIFO);
+    const int high = ::sched_get_priority_max(SCHED_FIFO);
+    if (priority < low || priority > high) {
+        return ::mystic::status::StatusCode::OUT_OF_RANGE;
+    }
+    struct sched_param param = {};
+    param.sched_priority = priority;
+    return internal::statusFromErrno(::pthread_setschedparam(::pthread_self(), SCHED_FIFO, &param));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    (void)priority;
+    return ::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL)
+               ? ::mystic::status::StatusCode::OK
+               : ::mystic::status::StatusCode::PERMISSION_DENIED;
+#else
+    (void)priority;
+    return ::mystic::status::StatusCode::UNIMPLEMENTED;
+#endif
+}
+
+/**
+ * @brief Switches the caller back to normal time-sharing scheduling.
+ */
+inline ::mystic::status::StatusCode set_normal_scheduling() noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+    struct sched_param param = {};
+    param.sched_priority = 0;
+    return internal::statusFromErrno(::pthread_setschedparam(::pthread_self(), SCHED_OTHER, &param));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    return ::SetThreadPriority(::GetCurrentThread(), THREAD_PRIORITY_NORMAL)
+               ? ::mystic::status::StatusCode::OK
+               : ::mystic::status::StatusCode::INTERNAL;
+#else
+    return ::mystic::status::StatusCode::UNIMPLEMENTED;
+#endif
+}
+
+/**
+ * @brief Sets the caller's nice value, in [-20, 19] (lower runs first).
+ * Linux applies it to the calling thread only, lowering needs CAP_SYS_NICE.
+ */
+inline ::mystic::status::StatusCode set_nice(int nice) noexcept {
+    if (nice < -20 || nice > 19) {
+        return ::mystic::status::StatusCode::OUT_OF_RANGE;
+    }
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    if (::setpriority(PRIO_PROCESS, static_cast<id_t>(os_id()), nice) != 0) {
+        return internal::statusFromErrno(errno);
+    }
+    return ::mystic::status::StatusCode::OK;
+#else
+    return ::mystic::status::StatusCode::UNIMPLEMENTED;
+#endif
+}
+
+} // namespace thread
+} // namespace platform
+} // namespace mystic
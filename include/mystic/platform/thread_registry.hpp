@@ -0,0 +1,304 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/platform/thread_registry.hpp
+ * @file thread_registry.hpp
+ * @brief Defines the registry of live threads and their dense indices.
+ *
+ * @details
+ * This header provides the identity half of `mystic::platform::thread`,
+ * kept apart from the naming and scheduling helpers of `thread.hpp` so
+ * that low-level code (per-CPU slots, profiling buffers) can use it
+ * without pulling in `mystic::status`:
+ *
+ * 1. `os_id()` returns the OS thread id (`gettid` on Linux), cached in a
+ *    thread-local after the first call.
+ * 2. `index()` returns a dense small integer, unique among live registered
+ *    threads, and reused after a thread exits. The first call registers
+ *    the thread.
+ * 3. `index_bound()` and `for_each()` describe the registered threads.
+ *
+ * @code{.cpp}
+ * #include "mystic/platform/thread_registry.hpp"
+ *
+ * namespace thread = mystic::platform::thread;
+ *
+ * counters[thread::index()].fetch_add(1, std::memory_order_relaxed);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <cstring>
+#include <mutex>
+#include <vector>
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <sys/syscall.h>
+# include <unistd.h>
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+# include <pthread.h>
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+# ifndef NOMINMAX
+#  define NOMINMAX
+# endif
+# ifndef WIN32_LEAN_AND_MEAN
+#  define WIN32_LEAN_AND_MEAN
+# endif
+# include <windows.h>
+#endif
+
+/**
+ * @namespace mystic::platform::internal
+ * @brief Internal implementation details of platform.
+ *
+ * @details
+ * This namespace contains internal implementation details of platform.
+ * **It should not be used directly.**
+ */
+namespace mystic::platform::internal {
+
+/// Maximum thread name length, the Linux limit (excluding the terminator).
+inline constexpr ::mystic::types::size_t kMaxThreadNameLength = 15;
+
+/// Marks a thread-local cache as not yet filled.
+inline constexpr ::mystic::types::size_t kNoThreadIndex = static_cast<::mystic::types::size_t>(-1);
+
+/**
+ * @brief Registry entry of a live thread.
+ */
+struct ThreadRecord {
+    ::mystic::types::size_t index = kNoThreadIndex;
+    ::mystic::types::uint64_t os_id = 0;
+    char name[kMaxThreadNameLength + 1] = {};
+}; // struct ThreadRecord
+
+/**
+ * @brief Process-wide registry of live threads and their dense indices.
+ */
+class ThreadRegistry {
+public:
+    /**
+     * @brief Returns the registry, never destroyed, so threads exiting
+     * during static destruction can still unregister.
+     */
+    static ThreadRegistry& instance() noexcept {
+        static ThreadRegistry* registry = new ThreadRegistry();
+        return *registry;
+    }
+
+    /**
+     * @brief Adds record, and assigns it the lowest free index.
+     */
+    void add(ThreadRecord* record) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!free_indices_.empty()) {
+            // Keep the free list sorted descending, so back() is the lowest.
+            record->index = free_indices_.back();
+            free_indices_.pop_back();
+        } else {
+            record->index = next_index_++;
+        }
+        records_.push_back(record);
+    }
+
+    /**
+     * @brief Removes record, and frees its index.
+     */
+    void remove(ThreadRecord* record) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (::mystic::types::size_t position = 0; position < records_.size(); ++position) {
+            if (records_[position] == record) {
+                records_[position] = records_.back();
+                records_.pop_back();
+                break;
+            }
+        }
+        auto position = free_indices_.begin();
+        while (position != free_indices_.end() && *position > record->index) {
+            ++position;
+        }
+        free_indices_.insert(position, record->index);
+    }
+
+    /**
+     * @brief Sets the registered name of record.
+     */
+    void rename(ThreadRecord* record, const char* name) noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        std::strncpy(record->name, name, kMaxThreadNameLength);
+        record->name[kMaxThreadNameLength] = '\0';
+    }
+
+    /**
+     * @brief Calls fn on every live record, under the registry lock.
+     */
+    template <typename Function>
+    void forEach(Function&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (const ThreadRecord* record : records_) {
+            fn(*record);
+        }
+    }
+
+    /**
+     * @brief Returns one past the highest index ever assigned.
+     */
+    ::mystic::types::size_t indexBound() noexcept {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return next_index_;
+    }
+
+private:
+    ThreadRegistry() = default;
+
+    std::mutex mutex_;
+    std::vector<ThreadRecord*> records_;
+    std::vector<::mystic::types::size_t> free_indices_;
+    ::mystic::types::size_t next_index_ = 0;
+
+}; // class ThreadRegistry
+
+/**
+ * @brief Reads the OS thread id.
+ */
+inline ::mystic::types::uint64_t readOsThreadId() noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    return static_cast<::mystic::types::uint64_t>(::syscall(SYS_gettid));
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+    ::mystic::types::uint64_t id = 0;
+    ::pthread_threadid_np(nullptr, &id);
+    return id;
+#elif (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_WINDOWS)
+    return static_cast<::mystic::types::uint64_t>(::GetCurrentThreadId());
+#else
+    return 0;
+#endif
+}
+
+/// Cached OS thread id, 0 until read.
+inline thread_local ::mystic::types::uint64_t tls_os_id = 0;
+
+/// Cached dense index, kept after unregistering, so late callers still get one.
+inline thread_local ::mystic::types::size_t tls_index = kNoThreadIndex;
+
+/**
+ * @brief Registration of the calling thread, undone at thread exit.
+ */
+class LocalThread {
+public:
+    LocalThread() {
+        record_.os_id = tls_os_id != 0 ? tls_os_id : readOsThreadId();
+        ThreadRegistry::instance().add(&record_);
+        tls_index = record_.index;
+    }
+
+    ~LocalThread() { ThreadRegistry::instance().remove(&record_); }
+
+    LocalThread(const LocalThread&) = delete;
+    LocalThread& operator=(const LocalThread&) = delete;
+
+    ThreadRecord& record() noexcept { return record_; }
+
+private:
+    ThreadRecord record_;
+
+}; // class LocalThread
+
+/**
+ * @brief Returns the calling thread's registration, registering it.
+ */
+inline LocalThread& localThread() {
+    thread_local LocalThread self;
+    return self;
+}
+
+} // namespace mystic::platform::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::platform
+ * @brief Operating system abstractions.
+ */
+namespace platform {
+
+/**
+ * @namespace mystic::platform::thread
+ * @brief Helpers acting on the calling thread.
+ */
+namespace thread {
+
+/**
+ * @brief Snapshot of a registered thread, passed to for_each().
+ */
+using thread_info = ::mystic::platform::internal::ThreadRecord;
+
+/**
+ * @brief Returns the OS thread id of the caller, cached after the first call.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::uint64_t os_id() noexcept {
+    if (MYSTIC_UNLIKELY(internal::tls_os_id == 0)) {
+        internal::tls_os_id = internal::readOsThreadId();
+    }
+    return internal::tls_os_id;
+}
+
+/**
+ * @brief Returns the dense index of the caller, registering it first.
+ * Unique among live registered threads, and reused after exit.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::size_t index() {
+    if (MYSTIC_UNLIKELY(internal::tls_index == internal::kNoThreadIndex)) {
+        internal::localThread();
+    }
+    return internal::tls_index;
+}
+
+/**
+ * @brief Returns one past the highest index ever assigned, the size a
+ * per-thread array needs to cover every registered thread so far.
+ */
+inline ::mystic::types::size_t index_bound() {
+    return internal::ThreadRegistry::instance().indexBound();
+}
+
+/**
+ * @brief Calls fn with the thread_info of every live registered thread.
+ * Runs under the registry lock, so fn must not register or name threads.
+ */
+template <typename Function>
+void for_each(Function&& fn) {
+    internal::ThreadRegistry::instance().forEach(static_cast<Function&&>(fn));
+}
+
+} // namespace thread
+} // namespace platform
+} // namespace mystic
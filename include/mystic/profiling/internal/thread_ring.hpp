@@ -0,0 +1,363 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/profiling/internal/thread_ring.hpp
+ * @file thread_ring.hpp
+ * @brief Per-thread record rings shared by zones, the sampler and traces.
+ *
+ * @details
+ * Every profiling producer follows the same shape: each thread appends
+ * records to its own single-producer ring, a collector drains all rings
+ * under a registry lock, and the ring of an exited thread is freed once
+ * drained. This header holds that shape once:
+ *
+ * 1. `ThreadRing<Record, Capacity>` is the ring, it drops (and counts)
+ *    records when full, and remembers its owner's identity. Spans are
+ *    pushed with `pushOpen()`/`pushClose()`: an accepted opening record
+ *    reserves the slot of its closing one, so a span is stored whole or
+ *    not at all.
+ * 2. `ThreadRingRegistry<Ring>` lists the rings, drains them, and frees
+ *    the retired ones.
+ * 3. `ThreadRingOwner<Ring>` retires the ring at thread exit, and points
+ *    the thread at an always-full discard ring, so records produced by
+ *    later thread_local destructors are dropped instead of reaching a
+ *    freed ring.
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/platform/thread_registry.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic::profiling::internal
+ * @brief Internal implementation details of profiling.
+ *
+ * @details
+ * This namespace contains internal implementation details of profiling.
+ * **It should not be used directly.**
+ */
+namespace mystic::profiling::internal {
+
+/**
+ * @brief Tag of the discard ring constructor.
+ */
+struct discard_ring_tag {};
+
+/**
+ * @brief Single-producer ring of one thread's records.
+ *
+ * @tparam Record The (trivially copyable) record type.
+ * @tparam Capacity The number of records, a power of two.
+ */
+template <typename Record, ::mystic::types::size_t Capacity>
+class ThreadRing {
+    static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                  "ThreadRing capacity must be a power of two.");
+
+public:
+    using record_type = Record;
+
+    ThreadRing() noexcept
+        : thread_index_(::mystic::platform::thread::index()),
+          thread_os_id_(::mystic::platform::thread::os_id()) {}
+
+    /**
+     * @brief Constructs a ring which is always full, shared by every
+     * exiting thread. Claims fail without writing, so it is never torn.
+     */
+    explicit ThreadRing(discard_ring_tag) noexcept : head_{Capacity}, discard_(true) {}
+
+    ThreadRing(const ThreadRing&) = delete;
+    ThreadRing& operator=(const ThreadRing&) = delete;
+
+    /**
+     * @brief Returns the slot to fill, or nullptr if the ring is full
+     * (owner only, async-signal-safe). Publish it with publish().
+     */
+    MYSTIC_FORCEINLINE Record* claim() noexcept {
+        const ::mystic::types::size_t head = head_.load(std::memory_order_relaxed);
+        if (!hasRoom(head, reserved_ + 1)) {
+            return nullptr;
+        }
+        return &records_[head & (Capacity - 1)];
+    }
+
+    /**
+     * @brief Publishes the claimed slot (owner only).
+     */
+    MYSTIC_FORCEINLINE void publish() noexcept {
+        head_.store(head_.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Appends record, or drops it if the ring is full (owner only).
+     *
+     * @returns True if the record was stored.
+     */
+    MYSTIC_FORCEINLINE bool push(const Record& record) noexcept {
+        const ::mystic::types::size_t head = head_.load(std::memory_order_relaxed);
+        if (!hasRoom(head, reserved_ + 1)) {
+            return false;
+        }
+        store(head, record);
+        return true;
+    }
+
+    /**
+     * @brief Appends the opening record of a span, and reserves a slot
+     * for its closing one, or drops it if fewer than 2 slots are free
+     * (owner only).
+     *
+     * @returns True if the record was stored, pushClose() then cannot fail.
+     */
+    MYSTIC_FORCEINLINE bool pushOpen(const Record& record) noexcept {
+        const ::mystic::types::size_t head = head_.load(std::memory_order_relaxed);
+        if (!hasRoom(head, reserved_ + 2)) {
+            return false;
+        }
+        store(head, record);
+        ++reserved_;
+        return true;
+    }
+
+    /**
+     * @brief Appends the closing record of the innermost open span into
+     * its reserved slot (owner only). Without an open span it is dropped,
+     * as its opening record was not stored.
+     */
+    MYSTIC_FORCEINLINE void pushClose(const Record& record) noexcept {
+        if (MYSTIC_UNLIKELY(reserved_ == 0)) {
+            return;
+        }
+        --reserved_;
+        store(head_.load(std::memory_order_relaxed), record);
+    }
+
+    /// Number of spans opened by pushOpen() and not closed yet (owner only)
+    ::mystic::types::size_t openSpans() const noexcept { return reserved_; }
+
+    /**
+     * @brief Passes every buffered record to fn (collector only).
+     *
+     * @returns The number of records passed.
+     */
+    template <typename Function>
+    ::mystic::types::size_t drain(Function&& fn) {
+        const ::mystic::types::size_t tail = tail_.load(std::memory_order_relaxed);
+        const ::mystic::types::size_t head = head_.load(std::memory_order_acquire);
+        for (::mystic::types::size_t position = tail; position != head; ++position) {
+            fn(static_cast<const Record&>(records_[position & (Capacity - 1)]));
+        }
+        tail_.store(head, std::memory_order_release);
+        return head - tail;
+    }
+
+    ::mystic::types::uint64_t dropped() const noexcept {
+        return dropped_.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Marks the owner as exited, the collector frees the ring.
+     */
+    void retire() noexcept { retired_.store(true, std::memory_order_release); }
+
+    bool isRetired() const noexcept { return retired_.load(std::memory_order_acquire); }
+
+    /// Dense index of the owner, see `mystic::platform::thread::index()`
+    ::mystic::types::size_t threadIndex() const noexcept { return thread_index_; }
+
+    /// OS thread id of the owner
+    ::mystic::types::uint64_t threadOsId() const noexcept { return thread_os_id_; }
+
+private:
+    /**
+     * @brief Returns true if count slots are free, reloading the tail only
+     * when the cached one says otherwise.
+     */
+    MYSTIC_FORCEINLINE bool hasRoom(::mystic::types::size_t head,
+                                    ::mystic::types::size_t count) noexcept {
+        return MYSTIC_LIKELY(Capacity - (head - cached_tail_) >= count) || refreshTail(head, count);
+    }
+
+    MYSTIC_FORCEINLINE void store(::mystic::types::size_t head, const Record& record) noexcept {
+        records_[head & (Capacity - 1)] = record;
+        head_.store(head + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Reloads the tail of a (nearly) full ring.
+     *
+     * @returns False if fewer than count slots are still free, the record
+     *          is dropped.
+     */
+    MYSTIC_NOINLINE bool refreshTail(::mystic::types::size_t head,
+                                     ::mystic::types::size_t count) noexcept {
+        if (discard_) {
+            return false;
+        }
+        cached_tail_ = tail_.load(std::memory_order_acquire);
+        if (Capacity - (head - cached_tail_) < count) {
+            dropped_.store(dropped_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /// Written by the owner
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) std::atomic<::mystic::types::size_t> head_{0};
+    ::mystic::types::size_t cached_tail_ = 0;
+    /// Slots kept free for the closing records of open spans
+    ::mystic::types::size_t reserved_ = 0;
+    std::atomic<::mystic::types::uint64_t> dropped_{0};
+
+    /// Written by the collector
+    alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) std::atomic<::mystic::types::size_t> tail_{0};
+
+    std::atomic<bool> retired_{false};
+    const bool discard_ = false;
+    const ::mystic::types::size_t thread_index_ = 0;
+    const ::mystic::types::uint64_t thread_os_id_ = 0;
+    Record records_[Capacity];
+
+}; // class ThreadRing
+
+/**
+ * @brief Process-wide list of the rings of one producer.
+ *
+ * @tparam Ring A ThreadRing, or a class derived from one.
+ */
+template <typename Ring>
+class ThreadRingRegistry {
+public:
+    void add(Ring* ring) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        rings_.push_back(ring);
+    }
+
+    /**
+     * @brief Calls fn(Ring&) on every ring, under the registry lock.
+     */
+    template <typename Function>
+    void forEach(Function&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (Ring* ring : rings_) {
+            fn(*ring);
+        }
+    }
+
+    /**
+     * @brief Calls fn(Ring&) on every ring to drain it, then frees the
+     * rings of exited threads.
+     *
+     * @returns The sum of what fn returned.
+     */
+    template <typename Function>
+    ::mystic::types::size_t drain(Function&& fn) {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ::mystic::types::size_t count = 0;
+        for (::mystic::types::size_t position = 0; position < rings_.size();) {
+            Ring* ring = rings_[position];
+            // Read the flag first, a retired owner produces nothing more.
+            const bool retired = ring->isRetired();
+            count += fn(*ring);
+            if (retired) {
+                retired_dropped_ += ring->dropped();
+                delete ring;
+                rings_[position] = rings_.back();
+                rings_.pop_back();
+            } else {
+                ++position;
+            }
+        }
+        return count;
+    }
+
+    /**
+     * @brief Returns the number of records dropped by every ring, freed
+     * ones included.
+     */
+    ::mystic::types::uint64_t dropped() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        ::mystic::types::uint64_t total = retired_dropped_;
+        for (const Ring* ring : rings_) {
+            total += ring->dropped();
+        }
+        return total;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<Ring*> rings_;
+    ::mystic::types::uint64_t retired_dropped_ = 0;
+
+}; // class ThreadRingRegistry
+
+/**
+ * @brief Returns the discard ring of Ring, leaked, since exiting threads
+ * may still use it during static destruction.
+ */
+template <typename Ring>
+Ring& discardRing() {
+    static Ring* ring = new Ring(discard_ring_tag{});
+    return *ring;
+}
+
+/**
+ * @brief Owns the calling thread's ring, as a thread_local, and retires it
+ * at thread exit.
+ */
+template <typename Ring>
+class ThreadRingOwner {
+public:
+    /**
+     * @brief Takes ring, published to the thread through slot, a
+     * constant-initialized thread_local outliving this owner.
+     */
+    void own(Ring* ring, Ring** slot) noexcept {
+        ring_ = ring;
+        slot_ = slot;
+        *slot = ring;
+    }
+
+    ~ThreadRingOwner() {
+        if (ring_ != nullptr) {
+            // Later thread_local destructors must not reach the ring once
+            // the collector may have freed it.
+            *slot_ = &discardRing<Ring>();
+            ring_->retire();
+        }
+    }
+
+private:
+    Ring* ring_ = nullptr;
+    Ring** slot_ = nullptr;
+
+}; // class ThreadRingOwner
+
+} // namespace mystic::profiling::internal
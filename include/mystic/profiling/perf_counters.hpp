@@ -0,0 +1,757 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/profiling/perf_counters.hpp
+ * @file perf_counters.hpp
+ * @brief Defines hardware performance counters, and per-zone counter reports.
+ *
+ * @details
+ * This header provides `perf_counters`, a group of Linux perf events
+ * (cycles, instructions, cache and branch misses, ...) counting the
+ * calling thread, and `MYSTIC_PROFILE_PERF_ZONE(name)`, a profiling zone
+ * which also accumulates those counters, to report IPC and miss rates
+ * per zone.
+ *
+ * 1. The events are opened as one group with `perf_event_open`, so they
+ *    are scheduled onto the PMU together, and ratios between them are
+ *    meaningful even when the kernel multiplexes.
+ * 2. On x86-64, every event's page is mapped, and `read()` uses `rdpmc`
+ *    in user space (the seqlock protocol of `perf_event_mmap_page`),
+ *    about 20-40 cycles per event with no system call.
+ * 3. When `rdpmc` is not permitted, or an event is not currently on the
+ *    PMU (multiplexed out, or a software event), `read()` falls back to
+ *    one `read()` system call for the whole group.
+ *
+ * Both paths return the same raw counts (`offset + pmc`, what the kernel
+ * reports), not extrapolated for multiplexing, so any two samples can be
+ * subtracted. While the group is multiplexed out, no event counts.
+ *
+ * Counters count the thread that opened them, and must be read on that
+ * thread. Opening needs `perf_event_paranoid` <= 2 (kernel events are
+ * excluded) and a PMU, which many virtual machines lack: check the status
+ * `open()` returns. Elsewhere than Linux, `open()` returns UNIMPLEMENTED,
+ * and perf zones record nothing.
+ *
+ * @code{.cpp}
+ * #include "mystic/profiling/perf_counters.hpp"
+ *
+ * void resolve(Batch& batch) {
+ *     MYSTIC_PROFILE_PERF_ZONE("resolve");
+ *     ...
+ * }
+ *
+ * // Report
+ * mystic::profiling::for_each_perf_zone([](const mystic::profiling::perf_zone_report& zone) {
+ *     std::printf("%s IPC %.2f, %.1f cache MPKI\n", zone.zone->name, zone.ipc(),
+ *                 zone.cache_mpki());
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <initializer_list>
+#include <utility>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/profiling/zone.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <cerrno>
+# include <linux/perf_event.h>
+# include <sys/ioctl.h>
+# include <sys/mman.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::profiling
+ * @brief Profiling and tracing instrumentation.
+ */
+namespace profiling {
+
+/**
+ * @brief Countable event.
+ */
+enum class perf_event : ::mystic::types::uint8_t {
+    /// Core cycles
+    cycles,
+
+    /// Retired instructions
+    instructions,
+
+    /// Last level cache accesses
+    cache_references,
+
+    /// Last level cache misses
+    cache_misses,
+
+    /// Retired branch instructions
+    branches,
+
+    /// Mispredicted branches
+    branch_misses,
+
+    /// Cycles the front end delivered nothing (not on every CPU)
+    stalled_cycles_frontend,
+
+    /// Cycles the back end accepted nothing (not on every CPU)
+    stalled_cycles_backend,
+
+    /// CPU time of the thread, in nanoseconds (software)
+    task_clock,
+
+    /// Page faults (software)
+    page_faults,
+
+    /// Context switches (software)
+    context_switches,
+}; // enum class perf_event
+
+/// Largest number of events in a group.
+inline constexpr ::mystic::types::size_t kMaxPerfEvents = 8;
+
+/**
+ * @brief Raw values of a counter group, in the order the events were
+ * given.
+ */
+struct perf_sample {
+    ::mystic::types::uint64_t values[kMaxPerfEvents] = {};
+}; // struct perf_sample
+
+} // namespace profiling
+} // namespace mystic
+
+namespace mystic::profiling::internal {
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+
+/**
+ * @brief Maps an event to its perf_event_attr type and config.
+ */
+inline void perfEventConfig(perf_event event, struct perf_event_attr& attr) noexcept {
+    attr.type = PERF_TYPE_HARDWARE;
+    switch (event) {
+        case perf_event::cycles:
+            attr.config = PERF_COUNT_HW_CPU_CYCLES;
+            break;
+        case perf_event::instructions:
+            attr.config = PERF_COUNT_HW_INSTRUCTIONS;
+            break;
+        case perf_event::cache_references:
+            attr.config = PERF_COUNT_HW_CACHE_REFERENCES;
+            break;
+        case perf_event::cache_misses:
+            attr.config = PERF_COUNT_HW_CACHE_MISSES;
+            break;
+        case perf_event::branches:
+            attr.config = PERF_COUNT_HW_BRANCH_INSTRUCTIONS;
+            break;
+        case perf_event::branch_misses:
+            attr.config = PERF_COUNT_HW_BRANCH_MISSES;
+            break;
+        case perf_event::stalled_cycles_frontend:
+            attr.config = PERF_COUNT_HW_STALLED_CYCLES_FRONTEND;
+            break;
+        case perf_event::stalled_cycles_backend:
+            attr.config = PERF_COUNT_HW_STALLED_CYCLES_BACKEND;
+            break;
+        case perf_event::task_clock:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_TASK_CLOCK;
+            break;
+        case perf_event::page_faults:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_PAGE_FAULTS;
+            break;
+        case perf_event::context_switches:
+            attr.type = PERF_TYPE_SOFTWARE;
+            attr.config = PERF_COUNT_SW_CONTEXT_SWITCHES;
+            break;
+    }
+}
+
+/**
+ * @brief Maps a perf_event_open errno to a status code.
+ */
+inline status::StatusCode perfOpenError(int error) noexcept {
+    switch (error) {
+        case EACCES:
+        case EPERM:
+            return status::StatusCode::PERMISSION_DENIED;
+        case ENOENT:
+        case ENODEV:
+        case ENOSYS:
+        case EOPNOTSUPP:
+            return status::StatusCode::UNIMPLEMENTED;
+        case EMFILE:
+        case ENFILE:
+        case ENOSPC:
+            return status::StatusCode::RESOURCE_EXHAUSTED;
+        case EINVAL:
+            return status::StatusCode::INVALID_ARGUMENT;
+        default:
+            return status::StatusCode::INTERNAL;
+    }
+}
+
+#endif
+
+} // namespace mystic::profiling::internal
+
+namespace mystic {
+namespace profiling {
+
+/**
+ * @brief Group of perf events counting the calling thread.
+ */
+class perf_counters {
+public:
+    perf_counters() noexcept = default;
+
+    perf_counters(perf_counters&& other) noexcept { moveFrom(other); }
+
+    perf_counters& operator=(perf_counters&& other) noexcept {
+        if (this != &other) {
+            close();
+            moveFrom(other);
+        }
+        return *this;
+    }
+
+    perf_counters(const perf_counters&) = delete;
+    perf_counters& operator=(const perf_counters&) = delete;
+
+    ~perf_counters() { close(); }
+
+    /**
+     * @brief Opens events as one group counting the calling thread, and
+     * starts counting.
+     *
+     * @returns OK, INVALID_ARGUMENT (no events, more than kMaxPerfEvents,
+     *          or rejected by the kernel), PERMISSION_DENIED
+     *          (perf_event_paranoid), UNIMPLEMENTED (no such event, or
+     *          not Linux), RESOURCE_EXHAUSTED (out of descriptors), or
+     *          FAILED_PRECONDITION (already open).
+     */
+    status::StatusCode open(std::initializer_list<perf_event> events = {
+                                perf_event::cycles, perf_event::instructions,
+                                perf_event::cache_misses, perf_event::branch_misses}) {
+        if (count_ != 0) {
+            return status::StatusCode::FAILED_PRECONDITION;
+        }
+        if (events.size() == 0 || events.size() > kMaxPerfEvents) {
+            return status::StatusCode::INVALID_ARGUMENT;
+        }
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        // Set before mapping, close() unmaps with it if a later event fails.
+        page_size_ = static_cast<::mystic::types::size_t>(::sysconf(_SC_PAGESIZE));
+        for (const perf_event event : events) {
+            struct perf_event_attr attr = {};
+            attr.size = sizeof(attr);
+            internal::perfEventConfig(event, attr);
+            attr.disabled = count_ == 0 ? 1 : 0;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            attr.read_format = PERF_FORMAT_GROUP;
+
+            const int leader = count_ == 0 ? -1 : fds_[0];
+            const int fd = static_cast<int>(::syscall(SYS_perf_event_open, &attr, 0, -1, leader,
+                                                      PERF_FLAG_FD_CLOEXEC));
+            if (fd < 0) {
+                const status::StatusCode code = internal::perfOpenError(errno);
+                close();
+                return code;
+            }
+            fds_[count_] = fd;
+            events_[count_] = event;
+
+# if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+            // Only the first page (perf_event_mmap_page) is needed.
+            void* page = ::mmap(nullptr, page_size_, PROT_READ, MAP_SHARED, fd, 0);
+            pages_[count_] = page == MAP_FAILED
+                                 ? nullptr
+                                 : static_cast<const volatile struct perf_event_mmap_page*>(page);
+# endif
+            ++count_;
+        }
+        ::ioctl(fds_[0], PERF_EVENT_IOC_RESET, PERF_IOC_FLAG_GROUP);
+        ::ioctl(fds_[0], PERF_EVENT_IOC_ENABLE, PERF_IOC_FLAG_GROUP);
+        return status::StatusCode::OK;
+#else
+        return status::StatusCode::UNIMPLEMENTED;
+#endif
+    }
+
+    /**
+     * @brief Stops counting and releases the events.
+     */
+    void close() noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        // Members before the leader, closing the leader first would
+        // promote them to singleton groups.
+        for (::mystic::types::size_t index = count_; index-- > 0;) {
+            if (pages_[index] != nullptr) {
+                ::munmap(const_cast<struct perf_event_mmap_page*>(pages_[index]), page_size_);
+                pages_[index] = nullptr;
+            }
+            ::close(fds_[index]);
+        }
+#endif
+        count_ = 0;
+    }
+
+    MYSTIC_NODISCARD bool is_open() const noexcept { return count_ != 0; }
+
+    /**
+     * @brief Returns the number of events.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t size() const noexcept { return count_; }
+
+    /**
+     * @brief Returns the event at index.
+     */
+    MYSTIC_NODISCARD perf_event event(::mystic::types::size_t index) const noexcept {
+        return events_[index];
+    }
+
+    /**
+     * @brief Pauses counting.
+     */
+    void disable() noexcept { groupControl(kDisable); }
+
+    /**
+     * @brief Resumes counting.
+     */
+    void enable() noexcept { groupControl(kEnable); }
+
+    /**
+     * @brief Zeroes every counter.
+     */
+    void reset() noexcept { groupControl(kReset); }
+
+    /**
+     * @brief Reads every counter into out, with rdpmc if possible.
+     *
+     * @returns False if closed, or the read failed.
+     */
+    MYSTIC_FORCEINLINE bool read(perf_sample& out) const noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+        if (MYSTIC_LIKELY(readRdpmc(out))) {
+            return true;
+        }
+#endif
+        return readSyscall(out);
+    }
+
+    /**
+     * @brief Returns true if every event can currently be read with rdpmc.
+     */
+    MYSTIC_NODISCARD bool uses_rdpmc() const noexcept {
+        perf_sample ignored;
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+        return readRdpmc(ignored);
+#else
+        static_cast<void>(ignored);
+        return false;
+#endif
+    }
+
+private:
+    enum GroupControl { kEnable, kDisable, kReset };
+
+    void groupControl(GroupControl control) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        if (count_ == 0) {
+            return;
+        }
+        const unsigned long request = control == kEnable    ? PERF_EVENT_IOC_ENABLE
+                                      : control == kDisable ? PERF_EVENT_IOC_DISABLE
+                                                            : PERF_EVENT_IOC_RESET;
+        ::ioctl(fds_[0], request, PERF_IOC_FLAG_GROUP);
+#else
+        static_cast<void>(control);
+#endif
+    }
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+    /**
+     * @brief Reads every counter in user space, fails if any event is not
+     * on the PMU right now (index 0) or rdpmc is not permitted.
+     */
+    MYSTIC_FORCEINLINE bool readRdpmc(perf_sample& out) const noexcept {
+        if (MYSTIC_UNLIKELY(count_ == 0)) {
+            return false;
+        }
+        for (::mystic::types::size_t index = 0; index < count_; ++index) {
+            const volatile struct perf_event_mmap_page* page = pages_[index];
+            if (MYSTIC_UNLIKELY(page == nullptr)) {
+                return false;
+            }
+            ::mystic::types::uint32_t sequence;
+            ::mystic::types::uint64_t value;
+            do {
+                sequence = page->lock;
+                std::atomic_signal_fence(std::memory_order_acquire);
+                const ::mystic::types::uint32_t counter = page->index;
+                if (MYSTIC_UNLIKELY(!page->cap_user_rdpmc || counter == 0)) {
+                    return false;
+                }
+                const ::mystic::types::uint32_t width = page->pmc_width;
+                ::mystic::types::uint32_t low;
+                ::mystic::types::uint32_t high;
+                __asm__ __volatile__("rdpmc" : "=a"(low), "=d"(high) : "c"(counter - 1));
+                // Sign-extend the raw counter from pmc_width bits.
+                ::mystic::types::int64_t raw = static_cast<::mystic::types::int64_t>(
+                    (static_cast<::mystic::types::uint64_t>(high) << 32) | low);
+                raw = static_cast<::mystic::types::int64_t>(static_cast<::mystic::types::uint64_t>(raw)
+                                                            << (64 - width)) >>
+                      (64 - width);
+                value = static_cast<::mystic::types::uint64_t>(page->offset + raw);
+                std::atomic_signal_fence(std::memory_order_acquire);
+            } while (page->lock != sequence);
+            out.values[index] = value;
+        }
+        return true;
+    }
+#endif
+
+    /**
+     * @brief Reads the group with one system call.
+     */
+    MYSTIC_NOINLINE bool readSyscall(perf_sample& out) const noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        if (count_ == 0) {
+            return false;
+        }
+        // { nr, values[nr] }
+        ::mystic::types::uint64_t buffer[1 + kMaxPerfEvents];
+        const ::ssize_t size = ::read(fds_[0], buffer, sizeof(buffer));
+        if (size < static_cast<::ssize_t>((1 + count_) * sizeof(::mystic::types::uint64_t))) {
+            return false;
+        }
+        for (::mystic::types::size_t index = 0; index < count_; ++index) {
+            out.values[index] = buffer[1 + index];
+        }
+        return true;
+#else
+        static_cast<void>(out);
+        return false;
+#endif
+    }
+
+    void moveFrom(perf_counters& other) noexcept {
+        count_ = other.count_;
+        page_size_ = other.page_size_;
+        for (::mystic::types::size_t index = 0; index < kMaxPerfEvents; ++index) {
+            fds_[index] = other.fds_[index];
+            events_[index] = other.events_[index];
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+            pages_[index] = other.pages_[index];
+            other.pages_[index] = nullptr;
+#endif
+        }
+        other.count_ = 0;
+    }
+
+    /// Number of open events, 0 if closed
+    ::mystic::types::size_t count_ = 0;
+
+    ::mystic::types::size_t page_size_ = 0;
+
+    /// Descriptors, the group leader first
+    int fds_[kMaxPerfEvents] = {};
+
+    perf_event events_[kMaxPerfEvents] = {};
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    /// Mapped control pages, for rdpmc (null if unmapped)
+    const volatile struct perf_event_mmap_page* pages_[kMaxPerfEvents] = {};
+#endif
+
+}; // class perf_counters
+
+/**
+ * @brief Counters accumulated by a perf zone site, see
+ * `MYSTIC_PROFILE_PERF_ZONE`.
+ */
+class perf_zone_site {
+public:
+    /// Events counted by perf zones, in this order.
+    static constexpr perf_event kEvents[] = {perf_event::cycles, perf_event::instructions,
+                                             perf_event::cache_misses, perf_event::branch_misses};
+
+    /// Number of events counted by perf zones.
+    static constexpr ::mystic::types::size_t kEventCount = sizeof(kEvents) / sizeof(kEvents[0]);
+
+    explicit constexpr perf_zone_site(const zone_descriptor& zone) noexcept : zone_(&zone) {}
+
+    perf_zone_site(const perf_zone_site&) = delete;
+    perf_zone_site& operator=(const perf_zone_site&) = delete;
+
+    /**
+     * @brief Adds one execution, the difference between two samples.
+     */
+    void add(const perf_sample& begin, const perf_sample& end) noexcept {
+        if (MYSTIC_UNLIKELY(!linked_.load(std::memory_order_acquire))) {
+            link();
+        }
+        calls_.fetch_add(1, std::memory_order_relaxed);
+        for (::mystic::types::size_t index = 0; index < kEventCount; ++index) {
+            // A counter never runs backwards, guard the totals if a read did.
+            const ::mystic::types::uint64_t delta =
+                end.values[index] > begin.values[index] ? end.values[index] - begin.values[index] : 0;
+            totals_[index].fetch_add(delta, std::memory_order_relaxed);
+        }
+    }
+
+    /**
+     * @brief Returns the first site which recorded an execution.
+     */
+    static const perf_zone_site* first() noexcept {
+        return head().load(std::memory_order_acquire);
+    }
+
+    const perf_zone_site* next() const noexcept { return next_; }
+    const zone_descriptor* zone() const noexcept { return zone_; }
+    ::mystic::types::uint64_t calls() const noexcept {
+        return calls_.load(std::memory_order_relaxed);
+    }
+    ::mystic::types::uint64_t total(::mystic::types::size_t index) const noexcept {
+        return totals_[index].load(std::memory_order_relaxed);
+    }
+
+private:
+    static std::atomic<const perf_zone_site*>& head() noexcept {
+        static std::atomic<const perf_zone_site*> sites{nullptr};
+        return sites;
+    }
+
+    /**
+     * @brief Pushes the site on the list of sites, once.
+     */
+    MYSTIC_NOINLINE void link() noexcept {
+        if (linking_.exchange(true, std::memory_order_acq_rel)) {
+            // Another thread is linking it, counting meanwhile is fine.
+            return;
+        }
+        const perf_zone_site* expected = head().load(std::memory_order_relaxed);
+        do {
+            next_ = expected;
+        } while (!head().compare_exchange_weak(expected, this, std::memory_order_release,
+                                               std::memory_order_relaxed));
+        linked_.store(true, std::memory_order_release);
+    }
+
+    const zone_descriptor* zone_;
+    const perf_zone_site* next_ = nullptr;
+    std::atomic<bool> linking_{false};
+    std::atomic<bool> linked_{false};
+    std::atomic<::mystic::types::uint64_t> calls_{0};
+    std::atomic<::mystic::types::uint64_t> totals_[kEventCount] = {};
+
+}; // class perf_zone_site
+
+} // namespace profiling
+} // namespace mystic
+
+namespace mystic::profiling::internal {
+
+/**
+ * @brief The calling thread's perf zone counters as seen by zones.
+ */
+struct ZonePerfCountersSlot {
+    /// Counters to read, nullptr if unavailable
+    perf_counters* counters;
+
+    /// False until the first perf zone, or after thread exit
+    bool resolved;
+}; // struct ZonePerfCountersSlot
+
+/**
+ * @brief Returns the calling thread's slot (constant-initialized, so no
+ * TLS wrapper call).
+ */
+MYSTIC_FORCEINLINE ZonePerfCountersSlot& tlsZonePerfCounters() noexcept {
+    thread_local ZonePerfCountersSlot slot{nullptr, false};
+    return slot;
+}
+
+/**
+ * @brief Owns the calling thread's perf zone counters. At thread exit it
+ * leaves the slot resolved to nullptr, so perf zones in later
+ * thread_local destructors record nothing instead of reading it.
+ */
+struct ZonePerfCountersOwner {
+    perf_counters counters;
+
+    ~ZonePerfCountersOwner() {
+        ZonePerfCountersSlot& slot = tlsZonePerfCounters();
+        slot.counters = nullptr;
+        slot.resolved = true;
+    }
+}; // struct ZonePerfCountersOwner
+
+MYSTIC_NOINLINE inline perf_counters* openZonePerfCounters() {
+    thread_local ZonePerfCountersOwner owner;
+    const auto& events = perf_zone_site::kEvents;
+    ZonePerfCountersSlot& slot = tlsZonePerfCounters();
+    slot.counters = owner.counters.open({events[0], events[1], events[2], events[3]}) ==
+                            status::StatusCode::OK
+                        ? &owner.counters
+                        : nullptr;
+    slot.resolved = true;
+    return slot.counters;
+}
+
+/**
+ * @brief Returns the calling thread's perf zone counters, opened on first
+ * use, or nullptr if they could not be opened.
+ */
+MYSTIC_FORCEINLINE perf_counters* zonePerfCounters() {
+    const ZonePerfCountersSlot& slot = tlsZonePerfCounters();
+    if (MYSTIC_UNLIKELY(!slot.resolved)) {
+        return openZonePerfCounters();
+    }
+    return slot.counters;
+}
+
+} // namespace mystic::profiling::internal
+
+namespace mystic {
+namespace profiling {
+
+/**
+ * @brief Accumulates the perf counters of its own lifetime into a site.
+ */
+class scoped_perf_zone {
+public:
+    MYSTIC_FORCEINLINE explicit scoped_perf_zone(perf_zone_site& site)
+        : site_(&site), counters_(internal::zonePerfCounters()) {
+        if (counters_ != nullptr && !counters_->read(begin_)) {
+            counters_ = nullptr;
+        }
+    }
+
+    MYSTIC_FORCEINLINE ~scoped_perf_zone() {
+        perf_sample end;
+        if (counters_ != nullptr && counters_->read(end)) {
+            site_->add(begin_, end);
+        }
+    }
+
+    scoped_perf_zone(const scoped_perf_zone&) = delete;
+    scoped_perf_zone& operator=(const scoped_perf_zone&) = delete;
+
+private:
+    perf_zone_site* site_;
+    perf_counters* counters_;
+    perf_sample begin_;
+
+}; // class scoped_perf_zone
+
+/**
+ * @brief Counter totals of one perf zone site.
+ */
+struct perf_zone_report {
+    const zone_descriptor* zone;
+    ::mystic::types::uint64_t calls;
+    ::mystic::types::uint64_t cycles;
+    ::mystic::types::uint64_t instructions;
+    ::mystic::types::uint64_t cache_misses;
+    ::mystic::types::uint64_t branch_misses;
+
+    /**
+     * @brief Returns instructions per cycle.
+     */
+    double ipc() const noexcept {
+        return cycles == 0 ? 0.0 : static_cast<double>(instructions) / static_cast<double>(cycles);
+    }
+
+    /**
+     * @brief Returns cache misses per thousand instructions.
+     */
+    double cache_mpki() const noexcept {
+        return instructions == 0 ? 0.0
+                                 : 1000.0 * static_cast<double>(cache_misses) /
+                                       static_cast<double>(instructions);
+    }
+
+    /**
+     * @brief Returns branch misses per thousand instructions.
+     */
+    double branch_mpki() const noexcept {
+        return instructions == 0 ? 0.0
+                                 : 1000.0 * static_cast<double>(branch_misses) /
+                                       static_cast<double>(instructions);
+    }
+}; // struct perf_zone_report
+
+/**
+ * @brief Calls fn(const perf_zone_report&) for every perf zone site which
+ * recorded an execution. Totals of a site are read one by one, while
+ * other threads may still add to them.
+ */
+template <typename Function>
+void for_each_perf_zone(Function&& fn) {
+    for (const perf_zone_site* site = perf_zone_site::first(); site != nullptr;
+         site = site->next()) {
+        const perf_zone_report report{site->zone(),  site->calls(),  site->total(0),
+                                      site->total(1), site->total(2), site->total(3)};
+        fn(report);
+    }
+}
+
+} // namespace profiling
+} // namespace mystic
+
+/**
+ * @macro MYSTIC_PROFILE_PERF_ZONE(name)
+ * @brief Times the enclosing scope as the zone name (a string literal),
+ * like `MYSTIC_PROFILE_ZONE`, and accumulates its perf counters.
+ */
+#if MYSTIC_PROFILING_ENABLED
+# define MYSTIC_PROFILE_PERF_ZONE_IMPL(name, id)                                           \
+    MYSTIC_PROFILE_ZONE_IMPL(name, id);                                                     \
+    static ::mystic::profiling::perf_zone_site MYSTIC_PROFILE_ZONE_CONCAT(mystic_perf_site_, \
+                                                                          id)(              \
+        MYSTIC_PROFILE_ZONE_CONCAT(mystic_zone_descriptor_, id));                           \
+    const ::mystic::profiling::scoped_perf_zone MYSTIC_PROFILE_ZONE_CONCAT(mystic_perf_zone_, \
+                                                                           id)(             \
+        MYSTIC_PROFILE_ZONE_CONCAT(mystic_perf_site_, id))
+# define MYSTIC_PROFILE_PERF_ZONE(name)                                                     \
+    MYSTIC_PROFILE_PERF_ZONE_IMPL(name, MYSTIC_PROFILE_ZONE_ID)
+#else
+# define MYSTIC_PROFILE_PERF_ZONE(name) static_cast<void>(0)
+#endif
@@ -0,0 +1,645 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/profiling/sampler.hpp
+ * @file sampler.hpp
+ * @brief Defines in-process sampling CPU profiler.
+ *
+ * @details
+ * This header provides `sampler`, a CPU profiler built into the binary,
+ * for production containers where perf cannot be installed or is not
+ * permitted, and `folded_stacks`, which aggregates its samples into the
+ * folded-stack format of flame graph tools (flamegraph.pl, speedscope,
+ * inferno).
+ *
+ * 1. Every registered thread gets its own POSIX timer on its CPU-time
+ *    clock, delivering SIGPROF to that thread only (SIGEV_THREAD_ID), so
+ *    samples are proportional to the CPU each thread burns.
+ * 2. The signal handler walks the frame pointer chain from the
+ *    interrupted context, checking every frame against the thread's
+ *    stack bounds, so it is async-signal-safe: no allocation, no lock,
+ *    no unwinder. Code must keep frame pointers for complete stacks
+ *    (-fno-omit-frame-pointer -mno-omit-leaf-frame-pointer), otherwise
+ *    the caller of a frameless function is missing, as are callers
+ *    which tail-called.
+ * 3. The stack goes into the thread's single-producer ring. When the ring
+ *    is full the sample is dropped and counted, the handler never waits
+ *    for the collector.
+ * 4. `drain()` hands buffered samples to a collector, and symbolization
+ *    (dladdr, demangling) happens there, out of signal context.
+ *
+ * Only Linux on x86-64 and ARM64 is supported, elsewhere `start()` and
+ * `register_thread()` return UNIMPLEMENTED. The sampler owns SIGPROF while
+ * started.
+ *
+ * @code{.cpp}
+ * #include "mystic/profiling/sampler.hpp"
+ *
+ * namespace profiling = mystic::profiling;
+ *
+ * // On every thread to profile
+ * profiling::sampler::register_thread();
+ *
+ * profiling::sampler::start(std::chrono::milliseconds(10));
+ * ...
+ * profiling::sampler::stop();
+ *
+ * profiling::folded_stacks stacks;
+ * profiling::sampler::drain([&](const profiling::stack_sample& sample) { stacks.add(sample); });
+ *
+ * std::string folded;
+ * stacks.write(folded);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <charconv>
+#include <chrono>
+#include <cstdlib>
+#include <map>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/platform/thread.hpp"
+#include "mystic/profiling/zone.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) && \
+    ((MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64))
+# define MYSTIC_PROFILING_HAS_SAMPLER 1
+# include <cxxabi.h>
+# include <dlfcn.h>
+# include <pthread.h>
+# include <signal.h>
+# include <time.h>
+# include <ucontext.h>
+#else
+# define MYSTIC_PROFILING_HAS_SAMPLER 0
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::profiling
+ * @brief Profiling and tracing instrumentation.
+ */
+namespace profiling {
+
+/// Deepest stack a sample keeps, deeper frames are cut.
+inline constexpr ::mystic::types::size_t kSamplerMaxDepth = 64;
+
+/**
+ * @brief One sampled stack.
+ */
+struct stack_sample {
+    /// Program counters, innermost first. frames[0] is the interrupted
+    /// instruction, the others are return addresses.
+    const ::mystic::types::uintptr_t* frames;
+
+    ::mystic::types::size_t depth;
+
+    /// Thread the sample was taken on
+    zone_thread thread;
+}; // struct stack_sample
+
+} // namespace profiling
+} // namespace mystic
+
+namespace mystic::profiling::internal {
+
+/// Number of samples a thread buffers (a power of two).
+inline constexpr ::mystic::types::size_t kSampleBufferCapacity = 256;
+
+static_assert(std::atomic<::mystic::types::size_t>::is_always_lock_free,
+              "The sampler's signal handler requires lock-free atomics.");
+
+/**
+ * @brief One buffered stack.
+ */
+struct SampleSlot {
+    ::mystic::types::size_t depth;
+    ::mystic::types::uintptr_t frames[kSamplerMaxDepth];
+}; // struct SampleSlot
+
+/**
+ * @brief Single-producer ring of one thread's samples, written by the
+ * thread's own signal handler.
+ */
+class SampleBuffer : public ThreadRing<SampleSlot, kSampleBufferCapacity> {
+public:
+    SampleBuffer(::mystic::types::uintptr_t stack_low, ::mystic::types::uintptr_t stack_high) noexcept
+        : stack_low_(stack_low), stack_high_(stack_high) {}
+
+    ::mystic::types::uintptr_t stackLow() const noexcept { return stack_low_; }
+    ::mystic::types::uintptr_t stackHigh() const noexcept { return stack_high_; }
+
+#if MYSTIC_PROFILING_HAS_SAMPLER
+    /// The owner's CPU-time timer, deleted when retired
+    timer_t timer{};
+#endif
+
+private:
+    const ::mystic::types::uintptr_t stack_low_;
+    const ::mystic::types::uintptr_t stack_high_;
+
+}; // class SampleBuffer
+
+/**
+ * @brief Returns the calling thread's buffer pointer, nullptr while not
+ * registered (constant-initialized, so no TLS wrapper call in the handler).
+ */
+MYSTIC_FORCEINLINE SampleBuffer*& tlsSampleBuffer() noexcept {
+    thread_local SampleBuffer* buffer = nullptr;
+    return buffer;
+}
+
+#if MYSTIC_PROFILING_HAS_SAMPLER
+
+/**
+ * @brief Walks the frame pointer chain of the interrupted context into
+ * slot. Async-signal-safe, and never follows a frame outside
+ * [low, high).
+ */
+inline void walkStack(const ucontext_t* context, SampleSlot& slot, ::mystic::types::uintptr_t low,
+                      ::mystic::types::uintptr_t high) noexcept {
+# if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64)
+    const auto pc = static_cast<::mystic::types::uintptr_t>(context->uc_mcontext.gregs[REG_RIP]);
+    auto frame = static_cast<::mystic::types::uintptr_t>(context->uc_mcontext.gregs[REG_RBP]);
+# else
+    const auto pc = static_cast<::mystic::types::uintptr_t>(context->uc_mcontext.pc);
+    auto frame = static_cast<::mystic::types::uintptr_t>(context->uc_mcontext.regs[29]);
+# endif
+    constexpr ::mystic::types::uintptr_t kWord = sizeof(::mystic::types::uintptr_t);
+
+    slot.frames[0] = pc;
+    ::mystic::types::size_t depth = 1;
+    // Both ABIs store a frame record {previous frame, return address} at
+    // the frame pointer, and frames grow towards higher addresses.
+    while (depth < kSamplerMaxDepth) {
+        if (frame < low || frame > high - 2 * kWord || (frame & (kWord - 1)) != 0) {
+            break;
+        }
+        const auto* record = reinterpret_cast<const ::mystic::types::uintptr_t*>(frame);
+        const ::mystic::types::uintptr_t previous = record[0];
+        const ::mystic::types::uintptr_t return_address = record[1];
+        if (return_address == 0) {
+            break;
+        }
+        slot.frames[depth++] = return_address;
+        if (previous <= frame) {
+            break;
+        }
+        frame = previous;
+    }
+    slot.depth = depth;
+}
+
+/**
+ * @brief SIGPROF handler, records the interrupted stack.
+ */
+inline void onSamplerSignal(int, siginfo_t*, void* context) noexcept {
+    SampleBuffer* buffer = tlsSampleBuffer();
+    if (buffer == nullptr) {
+        return;
+    }
+    SampleSlot* slot = buffer->claim();
+    if (slot == nullptr) {
+        return;
+    }
+    walkStack(static_cast<const ucontext_t*>(context), *slot, buffer->stackLow(),
+              buffer->stackHigh());
+    buffer->publish();
+}
+
+#endif
+
+/**
+ * @brief Process-wide sampler state: registered threads and timers.
+ */
+class SamplerRegistry {
+public:
+    /**
+     * @brief Returns the registry (never destroyed, threads may exit late).
+     */
+    static SamplerRegistry& instance() {
+        static SamplerRegistry* registry = new SamplerRegistry();
+        return *registry;
+    }
+
+    status::StatusCode start(std::chrono::microseconds interval) {
+        if (interval.count() <= 0) {
+            return status::StatusCode::INVALID_ARGUMENT;
+        }
+#if MYSTIC_PROFILING_HAS_SAMPLER
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (running_) {
+            return status::StatusCode::ALREADY_EXISTS;
+        }
+        if (!handler_installed_) {
+            struct sigaction action = {};
+            action.sa_sigaction = &onSamplerSignal;
+            action.sa_flags = SA_SIGINFO | SA_RESTART;
+            sigemptyset(&action.sa_mask);
+            if (::sigaction(SIGPROF, &action, nullptr) != 0) {
+                return status::StatusCode::INTERNAL;
+            }
+            handler_installed_ = true;
+        }
+        interval_ = interval;
+        running_ = true;
+        buffers_.forEach([this](SampleBuffer& buffer) {
+            if (!buffer.isRetired()) {
+                arm(buffer, interval_);
+            }
+        });
+        return status::StatusCode::OK;
+#else
+        return status::StatusCode::UNIMPLEMENTED;
+#endif
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!running_) {
+            return;
+        }
+        running_ = false;
+        buffers_.forEach([](SampleBuffer& buffer) {
+            if (!buffer.isRetired()) {
+                arm(buffer, std::chrono::microseconds(0));
+            }
+        });
+    }
+
+    bool isRunning() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return running_;
+    }
+
+    /**
+     * @brief Creates the calling thread's buffer and timer.
+     */
+    status::StatusCode registerThread(SampleBuffer*& registered) {
+#if MYSTIC_PROFILING_HAS_SAMPLER
+        pthread_attr_t attributes;
+        if (::pthread_getattr_np(::pthread_self(), &attributes) != 0) {
+            return status::StatusCode::INTERNAL;
+        }
+        void* stack = nullptr;
+        ::mystic::types::size_t stack_size = 0;
+        const int stack_error = ::pthread_attr_getstack(&attributes, &stack, &stack_size);
+        ::pthread_attr_destroy(&attributes);
+        if (stack_error != 0) {
+            return status::StatusCode::INTERNAL;
+        }
+        const auto stack_low = reinterpret_cast<::mystic::types::uintptr_t>(stack);
+        auto* buffer = new SampleBuffer(stack_low, stack_low + stack_size);
+
+        struct sigevent event = {};
+        event.sigev_notify = SIGEV_THREAD_ID;
+        event.sigev_signo = SIGPROF;
+# if defined(sigev_notify_thread_id)
+        event.sigev_notify_thread_id = static_cast<pid_t>(::mystic::platform::thread::os_id());
+# else
+        event._sigev_un._tid = static_cast<pid_t>(::mystic::platform::thread::os_id());
+# endif
+        if (::timer_create(CLOCK_THREAD_CPUTIME_ID, &event, &buffer->timer) != 0) {
+            delete buffer;
+            return status::StatusCode::RESOURCE_EXHAUSTED;
+        }
+
+        tlsSampleBuffer() = buffer;
+        std::lock_guard<std::mutex> lock(mutex_);
+        buffers_.add(buffer);
+        if (running_) {
+            arm(*buffer, interval_);
+        }
+        registered = buffer;
+        return status::StatusCode::OK;
+#else
+        static_cast<void>(registered);
+        return status::StatusCode::UNIMPLEMENTED;
+#endif
+    }
+
+    /**
+     * @brief Deletes the calling thread's timer, the collector frees the
+     * buffer once drained.
+     */
+    void unregisterThread(SampleBuffer* buffer) {
+        // Signals still pending find no buffer, and are ignored.
+        tlsSampleBuffer() = nullptr;
+        std::atomic_signal_fence(std::memory_order_seq_cst);
+        std::lock_guard<std::mutex> lock(mutex_);
+#if MYSTIC_PROFILING_HAS_SAMPLER
+        ::timer_delete(buffer->timer);
+#endif
+        buffer->retire();
+    }
+
+    /**
+     * @brief Drains every buffer, and frees those of exited threads.
+     */
+    template <typename Function>
+    ::mystic::types::size_t drain(Function& fn) {
+        return buffers_.drain([&fn](SampleBuffer& buffer) {
+            const zone_thread thread{buffer.threadIndex(), buffer.threadOsId()};
+            return buffer.drain([&fn, &thread](const SampleSlot& slot) {
+                const stack_sample sample{slot.frames, slot.depth, thread};
+                fn(sample);
+            });
+        });
+    }
+
+    ::mystic::types::uint64_t dropped() { return buffers_.dropped(); }
+
+private:
+    SamplerRegistry() = default;
+
+    /**
+     * @brief Sets the period of buffer's timer, 0 disarms it.
+     */
+    static void arm(SampleBuffer& buffer, std::chrono::microseconds interval) noexcept {
+#if MYSTIC_PROFILING_HAS_SAMPLER
+        struct itimerspec period = {};
+        period.it_interval.tv_sec = static_cast<time_t>(interval.count() / 1000000);
+        period.it_interval.tv_nsec = static_cast<long>(interval.count() % 1000000) * 1000;
+        period.it_value = period.it_interval;
+        ::timer_settime(buffer.timer, 0, &period, nullptr);
+#else
+        static_cast<void>(buffer);
+        static_cast<void>(interval);
+#endif
+    }
+
+    /// Guards the timers and the state below, taken before the buffers'
+    std::mutex mutex_;
+    ThreadRingRegistry<SampleBuffer> buffers_;
+    std::chrono::microseconds interval_{0};
+    bool running_ = false;
+    bool handler_installed_ = false;
+
+}; // class SamplerRegistry
+
+/**
+ * @brief Unregisters the calling thread at thread exit.
+ */
+struct SampleBufferOwner {
+    SampleBuffer* buffer = nullptr;
+
+    ~SampleBufferOwner() {
+        if (buffer != nullptr) {
+            SamplerRegistry::instance().unregisterThread(buffer);
+        }
+    }
+}; // struct SampleBufferOwner
+
+inline SampleBufferOwner& sampleBufferOwner() {
+    thread_local SampleBufferOwner owner;
+    return owner;
+}
+
+} // namespace mystic::profiling::internal
+
+namespace mystic {
+namespace profiling {
+
+/**
+ * @brief Process-wide sampling profiler.
+ */
+class sampler {
+public:
+    /**
+     * @brief Starts sampling every registered thread, every interval of
+     * its CPU time.
+     *
+     * @returns OK, ALREADY_EXISTS if started, INVALID_ARGUMENT if interval
+     *          is not positive, UNIMPLEMENTED if unsupported here, or
+     *          INTERNAL if the signal handler could not be installed.
+     */
+    static status::StatusCode start(
+        std::chrono::microseconds interval = std::chrono::microseconds(10000)) {
+        return internal::SamplerRegistry::instance().start(interval);
+    }
+
+    /**
+     * @brief Stops sampling, buffered samples remain to be drained.
+     */
+    static void stop() { internal::SamplerRegistry::instance().stop(); }
+
+    /**
+     * @brief Returns true if sampling.
+     */
+    static bool is_running() { return internal::SamplerRegistry::instance().isRunning(); }
+
+    /**
+     * @brief Makes the calling thread sampled (while started), until it
+     * exits or calls unregister_thread().
+     *
+     * @returns OK, ALREADY_EXISTS if registered, UNIMPLEMENTED if
+     *          unsupported here, RESOURCE_EXHAUSTED if no timer could be
+     *          created, or INTERNAL if the stack bounds are unknown.
+     */
+    static status::StatusCode register_thread() {
+        internal::SampleBufferOwner& owner = internal::sampleBufferOwner();
+        if (owner.buffer != nullptr) {
+            return status::StatusCode::ALREADY_EXISTS;
+        }
+        return internal::SamplerRegistry::instance().registerThread(owner.buffer);
+    }
+
+    /**
+     * @brief Stops sampling the calling thread.
+     */
+    static void unregister_thread() {
+        internal::SampleBufferOwner& owner = internal::sampleBufferOwner();
+        if (owner.buffer != nullptr) {
+            internal::SamplerRegistry::instance().unregisterThread(owner.buffer);
+            owner.buffer = nullptr;
+        }
+    }
+
+    /**
+     * @brief Passes every sample taken since the last drain to
+     * fn(const stack_sample&), thread by thread. The frames are only
+     * valid during the call.
+     *
+     * @returns The number of samples passed.
+     */
+    template <typename Function>
+    static ::mystic::types::size_t drain(Function&& fn) {
+        return internal::SamplerRegistry::instance().drain(fn);
+    }
+
+    /**
+     * @brief Returns the number of samples dropped because a ring was full.
+     */
+    static ::mystic::types::uint64_t dropped_samples() {
+        return internal::SamplerRegistry::instance().dropped();
+    }
+
+}; // class sampler
+
+/**
+ * @brief Aggregates samples by stack, and writes them as folded stacks.
+ */
+class folded_stacks {
+public:
+    /**
+     * @brief Counts one sample.
+     */
+    void add(const stack_sample& sample) {
+        // Return addresses point past the call, step back into it so the
+        // caller's symbol (and line) is found.
+        std::vector<::mystic::types::uintptr_t> stack(sample.frames, sample.frames + sample.depth);
+        for (::mystic::types::size_t index = 1; index < stack.size(); ++index) {
+            --stack[index];
+        }
+        ++stacks_[stack];
+        ++sample_count_;
+    }
+
+    /**
+     * @brief Writes one "outer;...;inner count" line per distinct stack
+     * into out (cleared first).
+     *
+     * @returns The size of the output, in bytes.
+     */
+    ::mystic::types::size_t write(std::string& out) {
+        // Stacks differing only in program counters within the same
+        // functions fold into one line.
+        std::map<std::string, ::mystic::types::uint64_t> lines;
+        std::string line;
+        for (const auto& [stack, count] : stacks_) {
+            line.clear();
+            for (::mystic::types::size_t index = stack.size(); index-- > 0;) {
+                line.append(symbol(stack[index]));
+                if (index != 0) {
+                    line.push_back(';');
+                }
+            }
+            lines[line] += count;
+        }
+
+        out.clear();
+        for (const auto& [folded, count] : lines) {
+            out.append(folded);
+            out.push_back(' ');
+            char digits[24];
+            const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), count);
+            out.append(digits, static_cast<::mystic::types::size_t>(result.ptr - digits));
+            out.push_back('\n');
+        }
+        return out.size();
+    }
+
+    /**
+     * @brief Forgets every sample (symbols stay cached).
+     */
+    void clear() noexcept {
+        stacks_.clear();
+        sample_count_ = 0;
+    }
+
+    /**
+     * @brief Returns the number of distinct stacks (by program counters).
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t size() const noexcept { return stacks_.size(); }
+
+    /**
+     * @brief Returns the number of samples added.
+     */
+    MYSTIC_NODISCARD ::mystic::types::uint64_t sample_count() const noexcept {
+        return sample_count_;
+    }
+
+private:
+    /**
+     * @brief Returns the (cached) name of the function containing pc.
+     */
+    const std::string& symbol(::mystic::types::uintptr_t pc) {
+        const auto found = symbols_.find(pc);
+        if (found != symbols_.end()) {
+            return found->second;
+        }
+        std::string name;
+#if MYSTIC_PROFILING_HAS_SAMPLER
+        Dl_info info;
+        if (::dladdr(reinterpret_cast<void*>(pc), &info) != 0) {
+            if (info.dli_sname != nullptr) {
+                int status = 0;
+                char* demangled = abi::__cxa_demangle(info.dli_sname, nullptr, nullptr, &status);
+                name = status == 0 && demangled != nullptr ? demangled : info.dli_sname;
+                std::free(demangled);
+            } else if (info.dli_fname != nullptr) {
+                // No symbol (static function, stripped binary): module+offset.
+                const char* module = info.dli_fname;
+                for (const char* cursor = info.dli_fname; *cursor != '\0'; ++cursor) {
+                    if (*cursor == '/') {
+                        module = cursor + 1;
+                    }
+                }
+                name = module;
+                name.append("+0x");
+                appendHex(name, pc - reinterpret_cast<::mystic::types::uintptr_t>(info.dli_fbase));
+            }
+        }
+#endif
+        if (name.empty()) {
+            name = "0x";
+            appendHex(name, pc);
+        }
+        // Folded stacks split frames on ';'.
+        for (char& c : name) {
+            if (c == ';') {
+                c = ':';
+            }
+        }
+        return symbols_.emplace(pc, std::move(name)).first->second;
+    }
+
+    static void appendHex(std::string& out, ::mystic::types::uintptr_t value) {
+        char digits[24];
+        const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value, 16);
+        out.append(digits, static_cast<::mystic::types::size_t>(result.ptr - digits));
+    }
+
+    std::map<std::vector<::mystic::types::uintptr_t>, ::mystic::types::uint64_t> stacks_;
+    std::unordered_map<::mystic::types::uintptr_t, std::string> symbols_;
+    ::mystic::types::uint64_t sample_count_ = 0;
+
+}; // class folded_stacks
+
+} // namespace profiling
+} // namespace mystic
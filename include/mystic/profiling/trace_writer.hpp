@@ -0,0 +1,718 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/profiling/trace_writer.hpp
+ * @file trace_writer.hpp
+ * @brief Defines streaming trace capture in the Chrome trace event format.
+ *
+ * @details
+ * This header provides `trace_writer`, which records begin/end, instant,
+ * counter and flow events from any thread, and streams them to a Chrome
+ * JSON trace file (chrome://tracing, Perfetto UI, speedscope) while the
+ * program runs, so memory stays bounded however long the capture.
+ *
+ * 1. An event is 40 bytes: a cycle-counter timestamp, pointers to its
+ *    (static) name and category, a value and a type. Emitting one is a
+ *    relaxed load of the enabled flag, a counter read, and a push into
+ *    the thread's single-producer ring. No lock, no allocation, no
+ *    formatting. When the ring is full the event is dropped and counted.
+ *    A recorded begin reserves the slot of its end, so a slice is
+ *    dropped whole, never left open or closing its parent. The end of a
+ *    slice begun before a restart is not written to the new file.
+ * 2. A background thread ("mystic-trace") drains every ring each flush
+ *    interval, encodes the events as JSON into a reused buffer, and
+ *    appends it to the file. Memory is the rings plus one interval's
+ *    worth of text.
+ * 3. Timestamps are converted from ticks to nanoseconds at encoding,
+ *    relative to the start of the session. Thread names set with
+ *    `mystic::platform::thread::set_name()` are reported as metadata.
+ *
+ * Names and categories are stored as pointers, they must outlive the
+ * session (string literals do). When profiling is disabled (see
+ * `MYSTIC_PROFILING_ENABLED`), `MYSTIC_TRACE_SCOPE` compiles to nothing.
+ *
+ * @code{.cpp}
+ * #include "mystic/profiling/trace_writer.hpp"
+ *
+ * namespace profiling = mystic::profiling;
+ *
+ * profiling::trace_writer::start("/tmp/server.trace.json");
+ *
+ * void handle(Request& request) {
+ *     MYSTIC_TRACE_SCOPE("handle");
+ *     profiling::trace_writer::counter("queue_depth", queue.size());
+ *     profiling::trace_writer::flow_begin("request", request.id);
+ * }
+ *
+ * profiling::trace_writer::stop();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <cerrno>
+#include <charconv>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <thread>
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/platform/thread.hpp"
+#include "mystic/profiling/internal/thread_ring.hpp"
+#include "mystic/profiling/zone.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/time/tick_source.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+# include <unistd.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::profiling
+ * @brief Profiling and tracing instrumentation.
+ */
+namespace profiling {
+
+/**
+ * @brief Kind of a trace event.
+ */
+enum class trace_event_type : ::mystic::types::uint8_t {
+    /// Opens a slice on the thread
+    begin,
+
+    /// Closes the innermost open slice on the thread
+    end,
+
+    /// Point in time on the thread
+    instant,
+
+    /// Value of a named counter
+    counter,
+
+    /// Starts a flow (an arrow between slices), identified by its value
+    flow_begin,
+
+    /// Continues a flow
+    flow_step,
+
+    /// Ends a flow
+    flow_end,
+}; // enum class trace_event_type
+
+} // namespace profiling
+} // namespace mystic
+
+namespace mystic::profiling::internal {
+
+/**
+ * @brief Binary trace event, as buffered.
+ */
+struct TraceEvent {
+    /// `time::cycle_tick_source` ticks
+    ::mystic::types::uint64_t timestamp;
+    const char* name;
+    const char* category;
+
+    /// Counter value, or flow id
+    ::mystic::types::int64_t value;
+
+    trace_event_type type;
+}; // struct TraceEvent
+
+/// Number of events a thread buffers (a power of two).
+inline constexpr ::mystic::types::size_t kTraceBufferCapacity = 16384;
+
+/**
+ * @brief Single-producer ring of one thread's trace events.
+ */
+class TraceBuffer : public ThreadRing<TraceEvent, kTraceBufferCapacity> {
+public:
+    TraceBuffer() { std::memcpy(name_, ::mystic::platform::thread::name(), sizeof(name_)); }
+
+    explicit TraceBuffer(discard_ring_tag tag) noexcept : ThreadRing(tag) {}
+
+    /**
+     * @brief Returns the thread name when the buffer was created.
+     */
+    const char* name() const noexcept { return name_; }
+
+    /// True once the thread's metadata was written (drainer only)
+    bool described = false;
+
+    /// Slices begun in the current file and not yet ended (drainer only)
+    ::mystic::types::size_t open_slices = 0;
+
+private:
+    char name_[::mystic::platform::internal::kMaxThreadNameLength + 1] = {};
+
+}; // class TraceBuffer
+
+/**
+ * @brief Returns the flag every emit checks (constant-initialized).
+ */
+MYSTIC_FORCEINLINE std::atomic<bool>& traceEnabled() noexcept {
+    static std::atomic<bool> enabled{false};
+    return enabled;
+}
+
+/**
+ * @brief Appends text as a JSON string literal.
+ */
+inline void appendJsonString(std::string& out, const char* text) {
+    out.push_back('"');
+    for (const char* cursor = text; *cursor != '\0'; ++cursor) {
+        const auto c = static_cast<unsigned char>(*cursor);
+        if (c == '"' || c == '\\') {
+            out.push_back('\\');
+            out.push_back(static_cast<char>(c));
+        } else if (c < 0x20) {
+            static constexpr char kHex[] = "0123456789abcdef";
+            out.append("\\u00", 4);
+            out.push_back(kHex[c >> 4]);
+            out.push_back(kHex[c & 0xF]);
+        } else {
+            out.push_back(static_cast<char>(c));
+        }
+    }
+    out.push_back('"');
+}
+
+/**
+ * @brief Appends the decimal form of value.
+ */
+template <typename Integer>
+void appendTraceInteger(std::string& out, Integer value) {
+    char digits[24];
+    const std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+    out.append(digits, static_cast<::mystic::types::size_t>(result.ptr - digits));
+}
+
+/**
+ * @brief A trace session: the buffers of every thread, the output file
+ * and the drainer thread.
+ */
+class TraceSession {
+public:
+    /**
+     * @brief Returns the session, leaked like the buffers it lists.
+     */
+    static TraceSession& instance() {
+        static TraceSession* session = new TraceSession();
+        return *session;
+    }
+
+    status::StatusCode start(const char* path, std::chrono::milliseconds flush_interval) {
+        if (path == nullptr || flush_interval.count() <= 0) {
+            return status::StatusCode::INVALID_ARGUMENT;
+        }
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (drainer_.joinable()) {
+            return status::StatusCode::ALREADY_EXISTS;
+        }
+        file_ = std::fopen(path, "wb");
+        if (file_ == nullptr) {
+            return errno == EACCES ? status::StatusCode::PERMISSION_DENIED
+                   : errno == ENOENT ? status::StatusCode::NOT_FOUND
+                                     : status::StatusCode::UNAVAILABLE;
+        }
+
+        // Events left over from a previous session are older than the base.
+        base_ticks_ = time::cycle_tick_source::now();
+        nanoseconds_per_tick_ = 1e9 / static_cast<double>(time::cycle_tick_source::frequency());
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX) || (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_MACOS)
+        pid_ = static_cast<::mystic::types::uint64_t>(::getpid());
+#endif
+        first_event_ = true;
+        write_failed_ = false;
+        buffers_.forEach([](TraceBuffer& buffer) {
+            buffer.described = false;
+            buffer.open_slices = 0;
+        });
+        static constexpr char kHeader[] = "{\"displayTimeUnit\":\"ns\",\"traceEvents\":[\n";
+        write(kHeader, sizeof(kHeader) - 1);
+
+        {
+            std::lock_guard<std::mutex> stop_lock(stop_mutex_);
+            stopping_ = false;
+        }
+        drainer_ = std::thread([this, flush_interval] { run(flush_interval); });
+        traceEnabled().store(true, std::memory_order_release);
+        return status::StatusCode::OK;
+    }
+
+    status::StatusCode stop() {
+        std::lock_guard<std::mutex> lock(control_mutex_);
+        if (!drainer_.joinable()) {
+            return status::StatusCode::FAILED_PRECONDITION;
+        }
+        traceEnabled().store(false, std::memory_order_release);
+        {
+            std::lock_guard<std::mutex> stop_lock(stop_mutex_);
+            stopping_ = true;
+        }
+        stop_signal_.notify_one();
+        drainer_.join();
+
+        static constexpr char kFooter[] = "\n]}\n";
+        write(kFooter, sizeof(kFooter) - 1);
+        const bool closed = std::fclose(file_) == 0;
+        file_ = nullptr;
+        return write_failed_ || !closed ? status::StatusCode::DATA_LOSS : status::StatusCode::OK;
+    }
+
+    void add(TraceBuffer* buffer) { buffers_.add(buffer); }
+
+    ::mystic::types::uint64_t dropped() { return buffers_.dropped(); }
+
+private:
+    TraceSession() = default;
+
+    void run(std::chrono::milliseconds flush_interval) {
+        ::mystic::platform::thread::set_name("mystic-trace");
+        std::unique_lock<std::mutex> lock(stop_mutex_);
+        for (;;) {
+            const bool stopping =
+                stop_signal_.wait_for(lock, flush_interval, [this] { return stopping_; });
+            lock.unlock();
+            flush();
+            if (stopping) {
+                return;
+            }
+            lock.lock();
+        }
+    }
+
+    /**
+     * @brief Drains every buffer, and appends the encoded events to the
+     * file (drainer only).
+     */
+    void flush() {
+        chunk_.clear();
+        buffers_.drain([this](TraceBuffer& buffer) {
+            return buffer.drain([this, &buffer](const TraceEvent& event) { encodeEvent(buffer, event); });
+        });
+        write(chunk_.data(), chunk_.size());
+    }
+
+    void beginObject() {
+        if (!first_event_) {
+            chunk_.append(",\n", 2);
+        }
+        first_event_ = false;
+        chunk_.push_back('{');
+    }
+
+    void appendThreadFields(const TraceBuffer& buffer) {
+        chunk_.append("\"pid\":", 6);
+        appendTraceInteger(chunk_, pid_);
+        chunk_.append(",\"tid\":", 7);
+        appendTraceInteger(chunk_, buffer.threadOsId());
+    }
+
+    /**
+     * @brief Writes the thread_name metadata of buffer's thread, if named.
+     * The current name is preferred, the one at creation is kept for
+     * threads which already exited.
+     */
+    void describe(TraceBuffer& buffer) {
+        buffer.described = true;
+        const ::mystic::types::uint64_t os_id = buffer.threadOsId();
+        char name[::mystic::platform::internal::kMaxThreadNameLength + 1];
+        std::memcpy(name, buffer.name(), sizeof(name));
+        ::mystic::platform::thread::for_each([&](const ::mystic::platform::thread::thread_info& info) {
+            if (info.os_id == os_id) {
+                std::memcpy(name, info.name, sizeof(name));
+            }
+        });
+        if (name[0] == '\0') {
+            return;
+        }
+        beginObject();
+        chunk_.append("\"name\":\"thread_name\",\"ph\":\"M\",");
+        appendThreadFields(buffer);
+        chunk_.append(",\"args\":{\"name\":");
+        appendJsonString(chunk_, name);
+        chunk_.append("}}");
+    }
+
+    void encodeEvent(TraceBuffer& buffer, const TraceEvent& event) {
+        if (MYSTIC_UNLIKELY(event.timestamp < base_ticks_)) {
+            return;
+        }
+        // An end whose begin went to a previous file has nothing to close.
+        if (event.type == trace_event_type::begin) {
+            ++buffer.open_slices;
+        } else if (event.type == trace_event_type::end) {
+            if (MYSTIC_UNLIKELY(buffer.open_slices == 0)) {
+                return;
+            }
+            --buffer.open_slices;
+        }
+        if (MYSTIC_UNLIKELY(!buffer.described)) {
+            describe(buffer);
+        }
+
+        static constexpr const char* kPhases[] = {"B", "E", "i", "C", "s", "t", "f"};
+        beginObject();
+        if (event.type != trace_event_type::end) {
+            chunk_.append("\"name\":");
+            appendJsonString(chunk_, event.name);
+            chunk_.append(",\"cat\":");
+            appendJsonString(chunk_, event.category);
+            chunk_.push_back(',');
+        }
+        chunk_.append("\"ph\":\"");
+        chunk_.append(kPhases[static_cast<::mystic::types::size_t>(event.type)]);
+        chunk_.append("\",\"ts\":");
+        // Microseconds, with nanosecond decimals.
+        const auto nanoseconds = static_cast<::mystic::types::uint64_t>(
+            static_cast<double>(event.timestamp - base_ticks_) * nanoseconds_per_tick_);
+        appendTraceInteger(chunk_, nanoseconds / 1000);
+        const auto fraction = static_cast<unsigned>(nanoseconds % 1000);
+        const char decimals[4] = {'.', static_cast<char>('0' + fraction / 100),
+                                  static_cast<char>('0' + fraction / 10 % 10),
+                                  static_cast<char>('0' + fraction % 10)};
+        chunk_.append(decimals, 4);
+        chunk_.push_back(',');
+        appendThreadFields(buffer);
+
+        switch (event.type) {
+            case trace_event_type::instant:
+                chunk_.append(",\"s\":\"t\"");
+                break;
+            case trace_event_type::counter:
+                chunk_.append(",\"args\":{\"value\":");
+                appendTraceInteger(chunk_, event.value);
+                chunk_.push_back('}');
+                break;
+            case trace_event_type::flow_begin:
+            case trace_event_type::flow_step:
+            case trace_event_type::flow_end:
+                chunk_.append(",\"id\":");
+                appendTraceInteger(chunk_, event.value);
+                if (event.type == trace_event_type::flow_end) {
+                    // Bind to the enclosing slice, not the next one.
+                    chunk_.append(",\"bp\":\"e\"");
+                }
+                break;
+            default:
+                break;
+        }
+        chunk_.push_back('}');
+    }
+
+    void write(const char* data, ::mystic::types::size_t size) {
+        if (size != 0 && std::fwrite(data, 1, size, file_) != size) {
+            write_failed_ = true;
+        }
+        if (std::fflush(file_) != 0) {
+            write_failed_ = true;
+        }
+    }
+
+    /// Serializes start() and stop()
+    std::mutex control_mutex_;
+
+    ThreadRingRegistry<TraceBuffer> buffers_;
+
+    /// Wakes the drainer to stop
+    std::mutex stop_mutex_;
+    std::condition_variable stop_signal_;
+    bool stopping_ = false;
+
+    std::thread drainer_;
+
+    /// Session state, set by start() before the drainer runs
+    std::FILE* file_ = nullptr;
+    ::mystic::types::uint64_t base_ticks_ = 0;
+    double nanoseconds_per_tick_ = 1.0;
+    ::mystic::types::uint64_t pid_ = 0;
+
+    /// Drainer state
+    std::string chunk_;
+    bool first_event_ = true;
+    bool write_failed_ = false;
+
+}; // class TraceSession
+
+/**
+ * @brief Returns the calling thread's buffer pointer, nullptr until its
+ * first event, the discard buffer once retired (constant-initialized, so
+ * no TLS wrapper call).
+ */
+MYSTIC_FORCEINLINE TraceBuffer*& tlsTraceBuffer() noexcept {
+    thread_local TraceBuffer* buffer = nullptr;
+    return buffer;
+}
+
+MYSTIC_NOINLINE inline TraceBuffer& createTraceBuffer() {
+    thread_local ThreadRingOwner<TraceBuffer> owner;
+    auto* buffer = new TraceBuffer();
+    TraceSession::instance().add(buffer);
+    owner.own(buffer, &tlsTraceBuffer());
+    return *buffer;
+}
+
+MYSTIC_FORCEINLINE TraceBuffer& traceBuffer() {
+    TraceBuffer* buffer = tlsTraceBuffer();
+    if (MYSTIC_LIKELY(buffer != nullptr)) {
+        return *buffer;
+    }
+    return createTraceBuffer();
+}
+
+/**
+ * @brief Records an event on the calling thread, if tracing.
+ */
+MYSTIC_FORCEINLINE void emitTraceEvent(trace_event_type type, const char* name, const char* category,
+                                       ::mystic::types::int64_t value) {
+    if (MYSTIC_LIKELY(!traceEnabled().load(std::memory_order_relaxed))) {
+        return;
+    }
+    traceBuffer().push(TraceEvent{time::cycle_tick_source::now(), name, category, value, type});
+}
+
+/**
+ * @brief Returns the number of manual slices opened on the calling thread
+ * whose end must be skipped, as their begin was not recorded.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::size_t& tlsSkippedSlices() noexcept {
+    thread_local ::mystic::types::size_t skipped = 0;
+    return skipped;
+}
+
+/**
+ * @brief Opens a slice on the calling thread, if tracing and room is left
+ * for its end.
+ *
+ * @returns True if the begin was recorded, closeTraceSlice() must follow.
+ */
+MYSTIC_FORCEINLINE bool openTraceSlice(const char* name, const char* category) {
+    if (MYSTIC_LIKELY(!traceEnabled().load(std::memory_order_relaxed))) {
+        return false;
+    }
+    return traceBuffer().pushOpen(
+        TraceEvent{time::cycle_tick_source::now(), name, category, 0, trace_event_type::begin});
+}
+
+/**
+ * @brief Closes the slice recorded by the last openTraceSlice(), even if
+ * recording stopped meanwhile.
+ */
+MYSTIC_FORCEINLINE void closeTraceSlice() {
+    traceBuffer().pushClose(TraceEvent{time::cycle_tick_source::now(), "", "", 0, trace_event_type::end});
+}
+
+/**
+ * @brief Opens a manual slice, remembering a skipped one so its end is
+ * skipped too. Inside a skipped slice every slice is skipped, and so is
+ * one begun while not tracing inside a recorded one.
+ */
+inline void beginManualSlice(const char* name, const char* category) {
+    ::mystic::types::size_t& skipped = tlsSkippedSlices();
+    if (MYSTIC_UNLIKELY(skipped != 0)) {
+        ++skipped;
+    } else if (traceEnabled().load(std::memory_order_relaxed)) {
+        if (!traceBuffer().pushOpen(
+                TraceEvent{time::cycle_tick_source::now(), name, category, 0, trace_event_type::begin})) {
+            ++skipped;
+        }
+    } else {
+        const TraceBuffer* buffer = tlsTraceBuffer();
+        if (buffer != nullptr && buffer->openSpans() != 0) {
+            ++skipped;
+        }
+    }
+}
+
+/**
+ * @brief Closes the innermost manual slice, if its begin was recorded.
+ */
+inline void endManualSlice() {
+    ::mystic::types::size_t& skipped = tlsSkippedSlices();
+    if (MYSTIC_UNLIKELY(skipped != 0)) {
+        --skipped;
+    } else if (tlsTraceBuffer() != nullptr) {
+        closeTraceSlice();
+    }
+}
+
+} // namespace mystic::profiling::internal
+
+namespace mystic {
+namespace profiling {
+
+/**
+ * @brief Process-wide trace capture, streamed as Chrome trace JSON.
+ */
+class trace_writer {
+public:
+    /// Category of events emitted without one.
+    static constexpr const char* kDefaultCategory = "mystic";
+
+    /**
+     * @brief Creates (or truncates) the file at path, and starts
+     * recording, flushing to it every flush_interval.
+     *
+     * @returns OK, ALREADY_EXISTS if recording, INVALID_ARGUMENT,
+     *          PERMISSION_DENIED or NOT_FOUND if the file cannot be
+     *          created, UNAVAILABLE for other open failures.
+     */
+    static status::StatusCode start(
+        const char* path,
+        std::chrono::milliseconds flush_interval = std::chrono::milliseconds(100)) {
+        return internal::TraceSession::instance().start(path, flush_interval);
+    }
+
+    /**
+     * @brief Stops recording, writes the remaining events and closes the
+     * file.
+     *
+     * @returns OK, FAILED_PRECONDITION if not recording, or DATA_LOSS if
+     *          any write failed.
+     */
+    static status::StatusCode stop() { return internal::TraceSession::instance().stop(); }
+
+    /**
+     * @brief Returns true while recording.
+     */
+    MYSTIC_FORCEINLINE static bool is_enabled() noexcept {
+        return internal::traceEnabled().load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Opens a slice on the calling thread.
+     */
+    MYSTIC_FORCEINLINE static void begin(const char* name, const char* category = kDefaultCategory) {
+        internal::beginManualSlice(name, category);
+    }
+
+    /**
+     * @brief Closes the innermost slice opened by begin() on the calling
+     * thread. It is recorded only if the begin was.
+     */
+    MYSTIC_FORCEINLINE static void end() { internal::endManualSlice(); }
+
+    /**
+     * @brief Marks a point in time on the calling thread.
+     */
+    MYSTIC_FORCEINLINE static void instant(const char* name, const char* category = kDefaultCategory) {
+        internal::emitTraceEvent(trace_event_type::instant, name, category, 0);
+    }
+
+    /**
+     * @brief Records the value of the counter name.
+     */
+    MYSTIC_FORCEINLINE static void counter(const char* name, ::mystic::types::int64_t value,
+                                           const char* category = kDefaultCategory) {
+        internal::emitTraceEvent(trace_event_type::counter, name, category, value);
+    }
+
+    /**
+     * @brief Starts the flow id from the enclosing slice.
+     */
+    MYSTIC_FORCEINLINE static void flow_begin(const char* name, ::mystic::types::uint64_t id,
+                                              const char* category = kDefaultCategory) {
+        internal::emitTraceEvent(trace_event_type::flow_begin, name, category,
+                                 static_cast<::mystic::types::int64_t>(id));
+    }
+
+    /**
+     * @brief Continues the flow id through the enclosing slice.
+     */
+    MYSTIC_FORCEINLINE static void flow_step(const char* name, ::mystic::types::uint64_t id,
+                                             const char* category = kDefaultCategory) {
+        internal::emitTraceEvent(trace_event_type::flow_step, name, category,
+                                 static_cast<::mystic::types::int64_t>(id));
+    }
+
+    /**
+     * @brief Ends the flow id in the enclosing slice.
+     */
+    MYSTIC_FORCEINLINE static void flow_end(const char* name, ::mystic::types::uint64_t id,
+                                            const char* category = kDefaultCategory) {
+        internal::emitTraceEvent(trace_event_type::flow_end, name, category,
+                                 static_cast<::mystic::types::int64_t>(id));
+    }
+
+    /**
+     * @brief Returns the number of events dropped because a ring was full.
+     */
+    static ::mystic::types::uint64_t dropped_events() {
+        return internal::TraceSession::instance().dropped();
+    }
+
+}; // class trace_writer
+
+/**
+ * @brief Traces its own lifetime as a slice.
+ */
+class scoped_trace {
+public:
+    MYSTIC_FORCEINLINE explicit scoped_trace(const char* name,
+                                             const char* category = trace_writer::kDefaultCategory)
+        : recorded_(internal::openTraceSlice(name, category)) {}
+
+    MYSTIC_FORCEINLINE ~scoped_trace() {
+        // Close what was recorded, even if recording stopped meanwhile.
+        if (recorded_) {
+            internal::closeTraceSlice();
+        }
+    }
+
+    scoped_trace(const scoped_trace&) = delete;
+    scoped_trace& operator=(const scoped_trace&) = delete;
+
+private:
+    /// True if the begin was recorded, its end slot is reserved
+    bool recorded_;
+
+}; // class scoped_trace
+
+} // namespace profiling
+} // namespace mystic
+
+/**
+ * @macro MYSTIC_TRACE_SCOPE(name)
+ * @brief Traces the enclosing scope as a slice named name (a string
+ * literal).
+ */
+#if MYSTIC_PROFILING_ENABLED
+# define MYSTIC_TRACE_SCOPE(name)                                                          \
+    const ::mystic::profiling::scoped_trace MYSTIC_PROFILE_ZONE_CONCAT(                    \
+        mystic_trace_, MYSTIC_PROFILE_ZONE_ID)(name)
+#else
+# define MYSTIC_TRACE_SCOPE(name) static_cast<void>(0)
+#endif
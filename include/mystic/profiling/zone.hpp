@@ -0,0 +1,255 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/profiling/zone.hpp
+ * @file zone.hpp
+ * @brief Defines scoped profiling zones.
+ *
+ * @details
+ * This header provides `MYSTIC_PROFILE_ZONE(name)`, which times the
+ * enclosing scope, and `drain_zones()`, which hands the recorded zones to
+ * a collector.
+ *
+ * 1. Each zone site owns a `static constexpr zone_descriptor` (name,
+ *    function, file, line), so records carry a single pointer, and no
+ *    string is copied or hashed at run time.
+ * 2. A zone reads the cycle counter on entry and exit, and pushes one
+ *    record into its thread's single-producer ring. No lock, no atomic
+ *    read-modify-write. When the ring is full the record is dropped and
+ *    counted, the hot path never waits for the collector.
+ * 3. Rings of exited threads are kept until drained.
+ *
+ * `MYSTIC_PROFILING_ENABLED` decides whether zones exist at all. Zones
+ * are cheap enough to stay on in production, so it defaults to 1 in
+ * every build. Define `MYSTIC_DISABLE_PROFILING` to set it to 0, a
+ * disabled zone compiles to nothing.
+ *
+ * @code{.cpp}
+ * #include "mystic/profiling/zone.hpp"
+ *
+ * void parse(Request& request) {
+ *     MYSTIC_PROFILE_ZONE("parse");
+ *     ...
+ * }
+ *
+ * // Collector thread
+ * mystic::profiling::drain_zones([](const mystic::profiling::zone_record& record,
+ *                                   const mystic::profiling::zone_thread& thread) {
+ *     histograms[record.zone].record(record.end - record.begin);
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/profiling/internal/thread_ring.hpp"
+#include "mystic/time/tick_source.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @macro MYSTIC_PROFILING_ENABLED
+ * @brief 1 if profiling zones are compiled in.
+ */
+#if defined(MYSTIC_DISABLE_PROFILING)
+# define MYSTIC_PROFILING_ENABLED 0
+#else
+# define MYSTIC_PROFILING_ENABLED 1
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::profiling
+ * @brief Profiling and tracing instrumentation.
+ */
+namespace profiling {
+
+/**
+ * @brief Static description of a zone site.
+ */
+struct zone_descriptor {
+    const char* name;
+    const char* function;
+    const char* file;
+    ::mystic::types::uint32_t line;
+}; // struct zone_descriptor
+
+/**
+ * @brief One timed execution of a zone, in `time::cycle_tick_source` ticks.
+ */
+struct zone_record {
+    const zone_descriptor* zone;
+    ::mystic::types::uint64_t begin;
+    ::mystic::types::uint64_t end;
+
+    /// Number of enclosing zones on the same thread
+    ::mystic::types::uint32_t depth;
+}; // struct zone_record
+
+/**
+ * @brief Thread a record comes from.
+ */
+struct zone_thread {
+    /// Dense index, see `mystic::platform::thread::index()`
+    ::mystic::types::size_t index;
+
+    /// OS thread id
+    ::mystic::types::uint64_t os_id;
+}; // struct zone_thread
+
+} // namespace profiling
+} // namespace mystic
+
+namespace mystic::profiling::internal {
+
+/// Number of records a thread buffers (a power of two).
+inline constexpr ::mystic::types::size_t kZoneBufferCapacity = 8192;
+
+/**
+ * @brief Single-producer ring of one thread's zone records.
+ */
+using ZoneBuffer = ThreadRing<zone_record, kZoneBufferCapacity>;
+
+/**
+ * @brief Returns the list of zone buffers (never destroyed, threads may
+ * exit late).
+ */
+inline ThreadRingRegistry<ZoneBuffer>& zoneRegistry() {
+    static ThreadRingRegistry<ZoneBuffer>* registry = new ThreadRingRegistry<ZoneBuffer>();
+    return *registry;
+}
+
+/**
+ * @brief Zone state of a thread (constant-initialized and trivially
+ * destructible, so usable until the thread is gone).
+ */
+struct ZoneThreadState {
+    /// nullptr until the first zone, the discard buffer once retired
+    ZoneBuffer* buffer = nullptr;
+
+    /// Nesting depth of the open zones
+    ::mystic::types::uint32_t depth = 0;
+}; // struct ZoneThreadState
+
+MYSTIC_FORCEINLINE ZoneThreadState& tlsZoneState() noexcept {
+    thread_local ZoneThreadState state;
+    return state;
+}
+
+MYSTIC_NOINLINE inline ZoneBuffer& createZoneBuffer() {
+    thread_local ThreadRingOwner<ZoneBuffer> owner;
+    auto* buffer = new ZoneBuffer();
+    zoneRegistry().add(buffer);
+    owner.own(buffer, &tlsZoneState().buffer);
+    return *buffer;
+}
+
+MYSTIC_FORCEINLINE ZoneBuffer& zoneBuffer(ZoneThreadState& state) {
+    if (MYSTIC_LIKELY(state.buffer != nullptr)) {
+        return *state.buffer;
+    }
+    return createZoneBuffer();
+}
+
+} // namespace mystic::profiling::internal
+
+namespace mystic {
+namespace profiling {
+
+/**
+ * @brief Times its own lifetime as one execution of a zone.
+ */
+class scoped_zone {
+public:
+    MYSTIC_FORCEINLINE explicit scoped_zone(const zone_descriptor& zone) noexcept
+        : zone_(&zone), state_(&internal::tlsZoneState()), depth_(state_->depth++),
+          begin_(time::cycle_tick_source::now()) {}
+
+    MYSTIC_FORCEINLINE ~scoped_zone() {
+        const ::mystic::types::uint64_t end = time::cycle_tick_source::now();
+        state_->depth = depth_;
+        internal::zoneBuffer(*state_).push(zone_record{zone_, begin_, end, depth_});
+    }
+
+    scoped_zone(const scoped_zone&) = delete;
+    scoped_zone& operator=(const scoped_zone&) = delete;
+
+private:
+    const zone_descriptor* zone_;
+    internal::ZoneThreadState* state_;
+    ::mystic::types::uint32_t depth_;
+    ::mystic::types::uint64_t begin_;
+
+}; // class scoped_zone
+
+/**
+ * @brief Passes every zone recorded since the last drain to
+ * fn(const zone_record&, const zone_thread&), thread by thread, each in
+ * the order the zones ended.
+ *
+ * @returns The number of records passed.
+ */
+template <typename Function>
+::mystic::types::size_t drain_zones(Function&& fn) {
+    return internal::zoneRegistry().drain([&fn](internal::ZoneBuffer& buffer) {
+        const zone_thread thread{buffer.threadIndex(), buffer.threadOsId()};
+        return buffer.drain([&fn, &thread](const zone_record& record) { fn(record, thread); });
+    });
+}
+
+/**
+ * @brief Returns the number of records dropped because a ring was full.
+ */
+inline ::mystic::types::uint64_t dropped_zones() {
+    return internal::zoneRegistry().dropped();
+}
+
+} // namespace profiling
+} // namespace mystic
+
+/**
+ * @macro MYSTIC_PROFILE_ZONE(name)
+ * @brief Times the enclosing scope as the zone name (a string literal).
+ */
+#if MYSTIC_PROFILING_ENABLED
+# define MYSTIC_PROFILE_ZONE_CONCAT_HELPER(a, b) a##b
+# define MYSTIC_PROFILE_ZONE_CONCAT(a, b) MYSTIC_PROFILE_ZONE_CONCAT_HELPER(a, b)
+// Unique per expansion, so several zones may share a source line.
+# if defined(__COUNTER__)
+#  define MYSTIC_PROFILE_ZONE_ID __COUNTER__
+# else
+#  define MYSTIC_PROFILE_ZONE_ID __LINE__
+# endif
+# define MYSTIC_PROFILE_ZONE_IMPL(name, id)                                                \
+    static constexpr ::mystic::profiling::zone_descriptor MYSTIC_PROFILE_ZONE_CONCAT(      \
+        mystic_zone_descriptor_, id){name, __func__, __FILE__, __LINE__};                \
+    const ::mystic::profiling::scoped_zone MYSTIC_PROFILE_ZONE_CONCAT(mystic_zone_, id)(   \
+        MYSTIC_PROFILE_ZONE_CONCAT(mystic_zone_descriptor_, id))
+# define MYSTIC_PROFILE_ZONE(name) MYSTIC_PROFILE_ZONE_IMPL(name, MYSTIC_PROFILE_ZONE_ID)
+#else
+# define MYSTIC_PROFILE_ZONE(name) static_cast<void>(0)
+#endif
@@ -30,12 +30,12 @@
  */
 #pragma once
 
+#include <cctype>
 #include <string>
 
 #include "mystic/attributes/attributes.hpp"
 #include "mystic/macros/framework_api.hpp"
 #include "mystic/types/standard_int.hpp"
-#include "mystic/utility/string_utils.hpp"
 
 /**
  * @namespace mystic
@@ -239,7 +239,10 @@ MYSTIC_NODISCARD MYSTIC_FORCEINLINE
 StatusCode from_string(const std::string& str) noexcept {
 
     // Convert to uppercase for case-agnostic comparision.
-    std::string str_upper = std::string_utils::to_uppercase(str);
+    std::string str_upper = str;
+    for (char& c : str_upper) {
+        c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+    }
 
     if (str_upper == "OK") {
         return StatusCode::OK;
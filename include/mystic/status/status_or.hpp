@@ -0,0 +1,235 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/status/status_or.hpp
+ * @file status_or.hpp
+ * @brief Defines StatusOr, a value or a status code.
+ *
+ * @details
+ * This header provides StatusOr<T>, which either holds a value of type T
+ * (and `StatusCode::OK`), or a non-OK StatusCode describing why the value
+ * is absent. It is the return type of fallible operations, as we don't use
+ * exceptions.
+ *
+ * @code{.cpp}
+ * #include "mystic/status/status_or.hpp"
+ *
+ * mystic::status::StatusOr<int> parse(std::string_view text) {
+ *     if (text.empty()) {
+ *         return mystic::status::StatusCode::INVALID_ARGUMENT;
+ *     }
+ *     return 42;
+ * }
+ *
+ * // ... somewhere in code
+ * auto result = parse("42");
+ * if (result.ok()) {
+ *     use(*result);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/status/in_place.hpp"
+#include "mystic/status/status_code.hpp"
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::status
+ * @brief Status-specific functions and classes.
+ */
+namespace status {
+
+/**
+ * @brief Holds either a value of type T, or a non-OK StatusCode.
+ *
+ * @tparam T The type of the held value (must not be a reference,
+ *           or StatusCode itself).
+ *
+ * @note
+ * Constructing a StatusOr from `StatusCode::OK` is a programming error,
+ * as there would be no value to hold. Such objects hold
+ * `StatusCode::INTERNAL` instead.
+ */
+template <typename T>
+class StatusOr {
+    static_assert(!std::is_reference_v<T>,
+                  "StatusOr<T> can not hold a reference.");
+    static_assert(!std::is_same_v<std::remove_cv_t<T>, StatusCode>,
+                  "StatusOr<StatusCode> is ambiguous, use StatusCode.");
+
+    /// Helper to reject StatusOr/StatusCode/in_place_t in converting constructor.
+    template <typename U>
+    static constexpr bool is_value_convertible_v =
+        !std::is_same_v<std::decay_t<U>, StatusOr> &&
+        !std::is_same_v<std::decay_t<U>, StatusCode> &&
+        !std::is_same_v<std::decay_t<U>, in_place_t> &&
+        std::is_constructible_v<T, U&&>;
+
+public:
+    using value_type = T;
+
+    /**
+     * @brief Constructs from a non-OK status code.
+     */
+    StatusOr(StatusCode code) noexcept
+        : code_(code == StatusCode::OK ? StatusCode::INTERNAL : code) {}
+
+    /**
+     * @brief Constructs the value from anything T is constructible from.
+     */
+    template <typename U = T,
+              typename = std::enable_if_t<is_value_convertible_v<U>>>
+    StatusOr(U&& value) noexcept(std::is_nothrow_constructible_v<T, U&&>)
+        : code_(StatusCode::OK) {
+        ::new (static_cast<void*>(std::addressof(value_))) T(std::forward<U>(value));
+    }
+
+    /**
+     * @brief Constructs the value in place from the given arguments.
+     */
+    template <typename... Args>
+    explicit StatusOr(in_place_t, Args&&... args)
+        noexcept(std::is_nothrow_constructible_v<T, Args&&...>)
+        : code_(StatusCode::OK) {
+        ::new (static_cast<void*>(std::addressof(value_))) T(std::forward<Args>(args)...);
+    }
+
+    /**
+     * @brief Copy and move constructors.
+     */
+    StatusOr(const StatusOr& other) : code_(other.code_) {
+        if (other.ok()) {
+            ::new (static_cast<void*>(std::addressof(value_))) T(other.value_);
+        }
+    }
+
+    StatusOr(StatusOr&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        : code_(other.code_) {
+        if (other.ok()) {
+            ::new (static_cast<void*>(std::addressof(value_))) T(std::move(other.value_));
+        }
+    }
+
+    /**
+     * @brief Copy and move assignments.
+     */
+    StatusOr& operator=(const StatusOr& other) {
+        if (this != &other) {
+            reset();
+            if (other.ok()) {
+                ::new (static_cast<void*>(std::addressof(value_))) T(other.value_);
+            }
+            code_ = other.code_;
+        }
+        return *this;
+    }
+
+    StatusOr& operator=(StatusOr&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (this != &other) {
+            reset();
+            if (other.ok()) {
+                ::new (static_cast<void*>(std::addressof(value_))) T(std::move(other.value_));
+            }
+            code_ = other.code_;
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Destructor, destroys the value (if any).
+     */
+    ~StatusOr() { reset(); }
+
+    /**
+     * @brief Returns true if a value is held.
+     */
+    MYSTIC_NODISCARD bool ok() const noexcept { return code_ == StatusCode::OK; }
+
+    /**
+     * @brief Returns the status code (`StatusCode::OK` if a value is held).
+     */
+    MYSTIC_NODISCARD StatusCode code() const noexcept { return code_; }
+
+    /**
+     * @brief Accessors to the held value.
+     *
+     * @warning
+     * Calling these when `ok()` is false is undefined behaviour.
+     */
+    T& value() & noexcept { return value_; }
+    const T& value() const& noexcept { return value_; }
+    T&& value() && noexcept { return std::move(value_); }
+
+    T& operator*() & noexcept { return value_; }
+    const T& operator*() const& noexcept { return value_; }
+    T&& operator*() && noexcept { return std::move(value_); }
+
+    T* operator->() noexcept { return std::addressof(value_); }
+    const T* operator->() const noexcept { return std::addressof(value_); }
+
+    /**
+     * @brief Returns the held value, or fallback if none is held.
+     */
+    template <typename U>
+    T value_or(U&& fallback) const& {
+        return ok() ? value_ : static_cast<T>(std::forward<U>(fallback));
+    }
+
+    template <typename U>
+    T value_or(U&& fallback) && {
+        return ok() ? std::move(value_) : static_cast<T>(std::forward<U>(fallback));
+    }
+
+private:
+    /**
+     * @brief Destroys the held value (if any).
+     */
+    void reset() noexcept {
+        if (ok()) {
+            value_.~T();
+        }
+    }
+
+    /// Status code
+    StatusCode code_;
+
+    /// Value storage, only alive when code_ is OK
+    union {
+        T value_;
+    };
+
+}; // class StatusOr
+
+} // namespace status
+} // namespace mystic
@@ -0,0 +1,254 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/coarse_clock.hpp
+ * @file coarse_clock.hpp
+ * @brief Defines cached clocks updated by a background ticker.
+ *
+ * @details
+ * This header provides `coarse_clock` (wall time) and
+ * `coarse_steady_clock` (monotonic time), for callers which read the time
+ * very often but need it only to the millisecond, like log timestamps.
+ *
+ * Once `start()` is called, a background thread publishes both clocks
+ * into one cache line every interval, and `now()` is a single relaxed
+ * load, inlined into the caller. Before `start()` (and after `stop()`),
+ * `now()` falls back to the underlying `std::chrono` clock, so reads are
+ * always valid, only slower.
+ *
+ * Both satisfy the standard Clock requirements, and their time points are
+ * those of `std::chrono::system_clock` and `std::chrono::steady_clock`.
+ *
+ * @code{.cpp}
+ * #include "mystic/time/coarse_clock.hpp"
+ *
+ * namespace mt = mystic::time;
+ *
+ * mt::coarse_clock::start(std::chrono::microseconds(500));
+ *
+ * // Every log line
+ * record.timestamp = mt::coarse_clock::now();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <mutex>
+#include <thread>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/platform/thread.hpp"
+#include "mystic/status/status_code.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::time::internal {
+
+/**
+ * @brief Cached clock values, 0 while no ticker runs.
+ */
+struct alignas(MYSTIC_ARCH_CPU_CACHE_LINE_SIZE) CoarseClockState {
+    /// Nanoseconds since the system_clock epoch
+    std::atomic<::mystic::types::int64_t> system{0};
+
+    /// Nanoseconds since the steady_clock epoch
+    std::atomic<::mystic::types::int64_t> steady{0};
+}; // struct CoarseClockState
+
+/**
+ * @brief Returns the cached clock values (constant-initialized, no guard).
+ */
+MYSTIC_FORCEINLINE CoarseClockState& coarseClockState() noexcept {
+    static CoarseClockState state;
+    return state;
+}
+
+/**
+ * @brief Background thread refreshing CoarseClockState.
+ */
+class CoarseClockTicker {
+public:
+    /**
+     * @brief Returns the ticker (never destroyed, so it may outlive main()).
+     */
+    static CoarseClockTicker& instance() {
+        static CoarseClockTicker* ticker = new CoarseClockTicker();
+        return *ticker;
+    }
+
+    ::mystic::status::StatusCode start(std::chrono::microseconds interval) {
+        if (interval.count() <= 0) {
+            return ::mystic::status::StatusCode::INVALID_ARGUMENT;
+        }
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (thread_.joinable()) {
+            return ::mystic::status::StatusCode::ALREADY_EXISTS;
+        }
+        publish();
+        stopping_.store(false, std::memory_order_relaxed);
+        thread_ = std::thread([this, interval] { run(interval); });
+        return ::mystic::status::StatusCode::OK;
+    }
+
+    void stop() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!thread_.joinable()) {
+            return;
+        }
+        stopping_.store(true, std::memory_order_relaxed);
+        thread_.join();
+        CoarseClockState& state = coarseClockState();
+        state.system.store(0, std::memory_order_relaxed);
+        state.steady.store(0, std::memory_order_relaxed);
+    }
+
+    bool isRunning() {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return thread_.joinable();
+    }
+
+private:
+    CoarseClockTicker() = default;
+
+    static void publish() noexcept {
+        CoarseClockState& state = coarseClockState();
+        state.system.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::system_clock::now().time_since_epoch())
+                               .count(),
+                           std::memory_order_relaxed);
+        state.steady.store(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                               std::chrono::steady_clock::now().time_since_epoch())
+                               .count(),
+                           std::memory_order_relaxed);
+    }
+
+    void run(std::chrono::microseconds interval) {
+        ::mystic::platform::thread::set_name("mystic-clock");
+        auto next = std::chrono::steady_clock::now() + interval;
+        while (!stopping_.load(std::memory_order_relaxed)) {
+            std::this_thread::sleep_until(next);
+            publish();
+            next += interval;
+            // Fell behind (suspended, or overloaded), don't catch up in a burst.
+            const auto now = std::chrono::steady_clock::now();
+            if (next < now) {
+                next = now + interval;
+            }
+        }
+    }
+
+    std::mutex mutex_;
+    std::thread thread_;
+    std::atomic<bool> stopping_{false};
+
+}; // class CoarseClockTicker
+
+} // namespace mystic::time::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, timers and time formatting.
+ */
+namespace time {
+
+/**
+ * @brief Cached wall clock, in system_clock time points.
+ */
+class coarse_clock {
+public:
+    using rep = ::mystic::types::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration>;
+
+    static constexpr bool is_steady = false;
+
+    /**
+     * @brief Returns the time of the last tick, a single relaxed load.
+     */
+    MYSTIC_FORCEINLINE static time_point now() noexcept {
+        const rep cached = internal::coarseClockState().system.load(std::memory_order_relaxed);
+        if (MYSTIC_LIKELY(cached != 0)) {
+            return time_point(duration(cached));
+        }
+        return std::chrono::time_point_cast<duration>(std::chrono::system_clock::now());
+    }
+
+    /**
+     * @brief Starts the background ticker, shared with coarse_steady_clock.
+     *
+     * @param interval How often the cached values are refreshed, which
+     *                 bounds how far they lag behind.
+     * @returns StatusCode::OK, StatusCode::ALREADY_EXISTS if the ticker
+     * runs, or StatusCode::INVALID_ARGUMENT if interval is not positive.
+     */
+    static status::StatusCode start(
+        std::chrono::microseconds interval = std::chrono::microseconds(1000)) {
+        return internal::CoarseClockTicker::instance().start(interval);
+    }
+
+    /**
+     * @brief Stops the background ticker, now() reads the clock again.
+     */
+    static void stop() { internal::CoarseClockTicker::instance().stop(); }
+
+    /**
+     * @brief Returns true if the background ticker runs.
+     */
+    static bool is_running() { return internal::CoarseClockTicker::instance().isRunning(); }
+
+}; // class coarse_clock
+
+/**
+ * @brief Cached monotonic clock, in steady_clock time points.
+ */
+class coarse_steady_clock {
+public:
+    using rep = ::mystic::types::int64_t;
+    using period = std::nano;
+    using duration = std::chrono::duration<rep, period>;
+    using time_point = std::chrono::time_point<std::chrono::steady_clock, duration>;
+
+    static constexpr bool is_steady = true;
+
+    /**
+     * @brief Returns the time of the last tick, a single relaxed load.
+     */
+    MYSTIC_FORCEINLINE static time_point now() noexcept {
+        const rep cached = internal::coarseClockState().steady.load(std::memory_order_relaxed);
+        if (MYSTIC_LIKELY(cached != 0)) {
+            return time_point(duration(cached));
+        }
+        return std::chrono::time_point_cast<duration>(std::chrono::steady_clock::now());
+    }
+
+}; // class coarse_steady_clock
+
+} // namespace time
+} // namespace mystic
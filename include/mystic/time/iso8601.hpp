@@ -0,0 +1,232 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/iso8601.hpp
+ * @file iso8601.hpp
+ * @brief Defines allocation-free ISO 8601 / RFC 3339 timestamp formatter.
+ *
+ * @details
+ * This header provides `format_iso8601()`, which renders a
+ * `system_clock` time point as UTC, e.g. `2025-03-14T15:09:26.535Z`, into
+ * a caller buffer.
+ *
+ * 1. The `YYYY-MM-DDTHH:MM:SS` prefix is cached per thread for the last
+ *    second formatted, so consecutive log lines only copy it.
+ * 2. Digits are written two at a time from a 200-byte digit-pair table,
+ *    with no branch per digit, and no locale or format string parsing.
+ *
+ * The output is not NUL-terminated.
+ *
+ * @code{.cpp}
+ * #include "mystic/time/iso8601.hpp"
+ *
+ * namespace mt = mystic::time;
+ *
+ * char buffer[mt::kIso8601MaxLength];
+ * size_t length = mt::format_iso8601(buffer, sizeof(buffer),
+ *                                    std::chrono::system_clock::now(),
+ *                                    mt::iso8601_precision::microseconds);
+ * sink.write(buffer, length);
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <cstring>
+#include <limits>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+namespace mystic::time::internal {
+
+/// "00" to "99", two characters each
+inline constexpr char kDigitPairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// Length of "YYYY-MM-DDTHH:MM:SS".
+inline constexpr ::mystic::types::size_t kIso8601PrefixLength = 19;
+
+/**
+ * @brief Writes value as exactly count decimal digits (zero padded).
+ */
+MYSTIC_FORCEINLINE void writeDigits(char* out, ::mystic::types::uint32_t value,
+                                    ::mystic::types::uint32_t count) noexcept {
+    while (count >= 2) {
+        count -= 2;
+        std::memcpy(out + count, kDigitPairs + (value % 100) * 2, 2);
+        value /= 100;
+    }
+    if (count != 0) {
+        out[0] = static_cast<char>('0' + value % 10);
+    }
+}
+
+/**
+ * @brief Per-thread prefix of the last second formatted.
+ */
+struct Iso8601Cache {
+    ::mystic::types::int64_t second = std::numeric_limits<::mystic::types::int64_t>::min();
+    char prefix[kIso8601PrefixLength];
+}; // struct Iso8601Cache
+
+inline Iso8601Cache& iso8601Cache() noexcept {
+    thread_local Iso8601Cache cache;
+    return cache;
+}
+
+/**
+ * @brief Renders the prefix of second (since the epoch) into cache.
+ */
+MYSTIC_NOINLINE inline void renderIso8601Prefix(Iso8601Cache& cache,
+                                                ::mystic::types::int64_t second) noexcept {
+    using ::mystic::types::int64_t;
+    using ::mystic::types::uint32_t;
+
+    int64_t days = second / 86400;
+    int64_t of_day = second % 86400;
+    if (of_day < 0) {
+        of_day += 86400;
+        --days;
+    }
+
+    // Civil date from days since 1970-01-01 (H. Hinnant, "chrono-Compatible
+    // Low-Level Date Algorithms").
+    days += 719468;
+    const int64_t era = (days >= 0 ? days : days - 146096) / 146097;
+    const int64_t day_of_era = days - era * 146097;
+    const int64_t year_of_era =
+        (day_of_era - day_of_era / 1460 + day_of_era / 36524 - day_of_era / 146096) / 365;
+    const int64_t day_of_year =
+        day_of_era - (365 * year_of_era + year_of_era / 4 - year_of_era / 100);
+    const int64_t month_index = (5 * day_of_year + 2) / 153;
+    const int64_t day = day_of_year - (153 * month_index + 2) / 5 + 1;
+    const int64_t month = month_index < 10 ? month_index + 3 : month_index - 9;
+    const int64_t year = year_of_era + era * 400 + (month <= 2 ? 1 : 0);
+
+    char* out = cache.prefix;
+    writeDigits(out, static_cast<uint32_t>(year), 4);
+    out[4] = '-';
+    writeDigits(out + 5, static_cast<uint32_t>(month), 2);
+    out[7] = '-';
+    writeDigits(out + 8, static_cast<uint32_t>(day), 2);
+    out[10] = 'T';
+    writeDigits(out + 11, static_cast<uint32_t>(of_day / 3600), 2);
+    out[13] = ':';
+    writeDigits(out + 14, static_cast<uint32_t>(of_day / 60 % 60), 2);
+    out[16] = ':';
+    writeDigits(out + 17, static_cast<uint32_t>(of_day % 60), 2);
+    cache.second = second;
+}
+
+} // namespace mystic::time::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, timers and time formatting.
+ */
+namespace time {
+
+/**
+ * @brief Number of fractional second digits.
+ */
+enum class iso8601_precision : ::mystic::types::uint8_t {
+    seconds = 0,
+    milliseconds = 3,
+    microseconds = 6,
+    nanoseconds = 9
+}; // enum class iso8601_precision
+
+/// Longest output of format_iso8601(), "YYYY-MM-DDTHH:MM:SS.nnnnnnnnnZ".
+inline constexpr ::mystic::types::size_t kIso8601MaxLength = 30;
+
+/**
+ * @brief Writes when as an ISO 8601 UTC timestamp into buffer.
+ *
+ * @param buffer The output, not NUL-terminated.
+ * @param size The size of buffer, kIso8601MaxLength is always enough.
+ * @param when The time, its duration may be any of system_clock's units.
+ * @param precision The number of fractional second digits (truncated).
+ * @returns The number of characters written, or 0 if size is too small.
+ */
+template <typename Duration>
+::mystic::types::size_t format_iso8601(
+    char* buffer, ::mystic::types::size_t size,
+    std::chrono::time_point<std::chrono::system_clock, Duration> when,
+    iso8601_precision precision = iso8601_precision::milliseconds) noexcept {
+    using ::mystic::types::int64_t;
+    using ::mystic::types::uint32_t;
+
+    static constexpr uint32_t kDivisors[10] = {1000000000, 100000000, 10000000, 1000000,
+                                               100000,     10000,     1000,     100,
+                                               10,         1};
+
+    const auto digits = static_cast<uint32_t>(precision);
+    const ::mystic::types::size_t length =
+        internal::kIso8601PrefixLength + (digits != 0 ? 1 + digits : 0) + 1;
+    if (MYSTIC_UNLIKELY(size < length)) {
+        return 0;
+    }
+
+    const int64_t nanoseconds =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(when.time_since_epoch()).count();
+    int64_t second = nanoseconds / 1000000000;
+    int64_t fraction = nanoseconds % 1000000000;
+    if (fraction < 0) {
+        fraction += 1000000000;
+        --second;
+    }
+
+    internal::Iso8601Cache& cache = internal::iso8601Cache();
+    if (MYSTIC_UNLIKELY(cache.second != second)) {
+        internal::renderIso8601Prefix(cache, second);
+    }
+    std::memcpy(buffer, cache.prefix, internal::kIso8601PrefixLength);
+
+    char* out = buffer + internal::kIso8601PrefixLength;
+    if (digits != 0) {
+        *out++ = '.';
+        internal::writeDigits(out, static_cast<uint32_t>(fraction) / kDivisors[digits], digits);
+        out += digits;
+    }
+    *out = 'Z';
+    return length;
+}
+
+} // namespace time
+} // namespace mystic
@@ -0,0 +1,192 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/precise_sleep.hpp
+ * @file precise_sleep.hpp
+ * @brief Defines hybrid sleep-then-spin wait with microsecond precision.
+ *
+ * @details
+ * This header provides `sleep_until_precise()` and `sleep_for_precise()`.
+ * A plain sleep wakes tens of microseconds late (timer slack, and the
+ * scheduler's wakeup latency). These sleep until shortly before the
+ * deadline, then spin on `cycle_tick_source` with `cpu_relax()` for the
+ * rest.
+ *
+ * The head start (slack) adapts per thread: the oversleep of each sleep
+ * feeds a running mean and deviation, as TCP estimates round-trip times,
+ * and the slack is the mean plus four deviations. On an idle machine it
+ * settles within a few calls, under load it grows instead of missing.
+ *
+ * The first call calibrates the cycle counter (about 10 ms on x86), call
+ * `cycle_tick_source::frequency()` at startup to take that off the path.
+ *
+ * @code{.cpp}
+ * #include "mystic/time/precise_sleep.hpp"
+ *
+ * auto next = std::chrono::steady_clock::now();
+ * for (const Event& event : recording) {
+ *     next += event.gap;
+ *     mystic::time::sleep_until_precise(next);
+ *     replay(event);
+ * }
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <thread>
+#include <type_traits>
+
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/concurrency/cpu_relax.hpp"
+#include "mystic/time/tick_source.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <cerrno>
+# include <time.h>
+#endif
+
+namespace mystic::time::internal {
+
+/**
+ * @brief Per-thread oversleep estimate, in nanoseconds.
+ */
+class SleepSlack {
+public:
+    /// Bounds of the slack.
+    static constexpr ::mystic::types::int64_t kMinSlack = 2000;
+    static constexpr ::mystic::types::int64_t kMaxSlack = 2000000;
+
+    ::mystic::types::int64_t slack() const noexcept {
+        const ::mystic::types::int64_t slack = mean_ + 4 * deviation_;
+        return slack < kMinSlack ? kMinSlack : slack > kMaxSlack ? kMaxSlack : slack;
+    }
+
+    /**
+     * @brief Feeds the oversleep of one sleep.
+     */
+    void observe(::mystic::types::int64_t oversleep) noexcept {
+        const ::mystic::types::int64_t error = oversleep - mean_;
+        mean_ += error / 8;
+        deviation_ += ((error < 0 ? -error : error) - deviation_) / 4;
+    }
+
+private:
+    /// Mean oversleep, starts pessimistic
+    ::mystic::types::int64_t mean_ = 60000;
+
+    /// Mean absolute deviation of the oversleep
+    ::mystic::types::int64_t deviation_ = 10000;
+
+}; // class SleepSlack
+
+inline SleepSlack& sleepSlack() noexcept {
+    thread_local SleepSlack slack;
+    return slack;
+}
+
+/**
+ * @brief Sleeps until wake (may return early on a signal, or late).
+ */
+inline void sleepUntil(std::chrono::steady_clock::time_point wake) noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+    // steady_clock is CLOCK_MONOTONIC on Linux.
+    const auto since_epoch =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(wake.time_since_epoch()).count();
+    struct timespec spec;
+    spec.tv_sec = static_cast<time_t>(since_epoch / 1000000000);
+    spec.tv_nsec = static_cast<long>(since_epoch % 1000000000);
+    while (::clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &spec, nullptr) == EINTR) {
+    }
+#else
+    std::this_thread::sleep_until(wake);
+#endif
+}
+
+} // namespace mystic::time::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, timers and time formatting.
+ */
+namespace time {
+
+/**
+ * @brief Blocks until deadline, sleeping for most of the wait, and
+ * spinning on the cycle counter for the last stretch.
+ */
+template <typename Clock, typename Duration>
+void sleep_until_precise(const std::chrono::time_point<Clock, Duration>& deadline) noexcept {
+    using steady = std::chrono::steady_clock;
+
+    steady::time_point target;
+    if constexpr (std::is_same_v<Clock, steady>) {
+        target = std::chrono::time_point_cast<steady::duration>(deadline);
+    } else {
+        target = steady::now() +
+                 std::chrono::duration_cast<steady::duration>(deadline - Clock::now());
+    }
+
+    internal::SleepSlack& estimate = internal::sleepSlack();
+    const std::chrono::nanoseconds slack(estimate.slack());
+    steady::time_point now = steady::now();
+    if (target - now > slack) {
+        const steady::time_point wake = target - slack;
+        internal::sleepUntil(wake);
+        now = steady::now();
+        estimate.observe(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(now - wake).count());
+    }
+    if (now >= target) {
+        return;
+    }
+
+    // Spin for the rest, on the cycle counter, which is cheaper to read.
+    const double remaining = std::chrono::duration<double>(target - now).count();
+    const ::mystic::types::uint64_t end =
+        cycle_tick_source::now() +
+        static_cast<::mystic::types::uint64_t>(
+            remaining * static_cast<double>(cycle_tick_source::frequency()));
+    while (cycle_tick_source::now() < end) {
+        ::mystic::concurrency::cpu_relax();
+    }
+}
+
+/**
+ * @brief Blocks for duration, see sleep_until_precise().
+ */
+template <typename Rep, typename Period>
+void sleep_for_precise(const std::chrono::duration<Rep, Period>& duration) noexcept {
+    sleep_until_precise(std::chrono::steady_clock::now() +
+                        std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration));
+}
+
+} // namespace time
+} // namespace mystic
@@ -0,0 +1,231 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/tick_source.hpp
+ * @file tick_source.hpp
+ * @brief Defines cheap monotonic tick sources.
+ *
+ * @details
+ * This header provides monotonic tick sources cheaper than
+ * `std::chrono::steady_clock`, for code which reads the time on every
+ * event (timer wheels, rate limiters, pacing loops).
+ *
+ * 1. `cycle_tick_source` reads the CPU's counter (`rdtsc` on x86,
+ *    `cntvct_el0` on Arm64), a handful of cycles and no syscall. Its
+ *    frequency is calibrated once against `steady_clock` on x86 (which
+ *    assumes an invariant TSC, true of every x86 CPU of the last decade).
+ * 2. `coarse_tick_source` reads `CLOCK_MONOTONIC_COARSE` on Linux, the
+ *    time of the last scheduler tick (1 to 4 ms resolution), through the
+ *    vDSO without touching the counter hardware.
+ *
+ * Both fall back to `steady_clock` where the fast path does not exist.
+ * A tick source is a type with static `now()` and `frequency()` (ticks
+ * per second), `tick_scale` converts its ticks to a coarser unit with one
+ * multiply.
+ *
+ * @code{.cpp}
+ * #include "mystic/time/tick_source.hpp"
+ *
+ * namespace mt = mystic::time;
+ *
+ * mt::tick_scale<mt::coarse_tick_source> milliseconds(std::chrono::milliseconds(1));
+ * uint64_t now_ms = milliseconds.now();
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <chrono>
+#include <thread>
+
+#include "mystic/architecture/cpu_detection.hpp"
+#include "mystic/architecture/os_detection.hpp"
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/types/standard_int.hpp"
+
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(_MSC_VER)
+# include <intrin.h>
+#endif
+
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+# include <time.h>
+#endif
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, timers and time formatting.
+ */
+namespace time {
+
+/**
+ * @brief Monotonic tick source reading the CPU's cycle counter.
+ */
+struct cycle_tick_source {
+    /**
+     * @brief Returns the current tick.
+     */
+    MYSTIC_FORCEINLINE static ::mystic::types::uint64_t now() noexcept {
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+        return static_cast<::mystic::types::uint64_t>(__rdtsc());
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(_MSC_VER)
+        return static_cast<::mystic::types::uint64_t>(_ReadStatusReg(ARM64_CNTVCT));
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+        ::mystic::types::uint64_t ticks;
+        __asm__ __volatile__("mrs %0, cntvct_el0" : "=r"(ticks));
+        return ticks;
+#else
+        return static_cast<::mystic::types::uint64_t>(
+            std::chrono::steady_clock::now().time_since_epoch().count());
+#endif
+    }
+
+    /**
+     * @brief Returns the number of ticks per second.
+     * On x86 the first call calibrates, which takes about 10 ms.
+     */
+    static ::mystic::types::uint64_t frequency() noexcept {
+#if (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86_64) || (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_X86)
+        static const ::mystic::types::uint64_t calibrated = calibrate();
+        return calibrated;
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64) && defined(_MSC_VER)
+        return static_cast<::mystic::types::uint64_t>(_ReadStatusReg(ARM64_CNTFRQ));
+#elif (MYSTIC_ARCH_CPU == MYSTIC_ARCH_CPU_ARM64)
+        ::mystic::types::uint64_t hertz;
+        __asm__ __volatile__("mrs %0, cntfrq_el0" : "=r"(hertz));
+        return hertz;
+#else
+        return static_cast<::mystic::types::uint64_t>(std::chrono::steady_clock::period::den /
+                                                      std::chrono::steady_clock::period::num);
+#endif
+    }
+
+private:
+    /**
+     * @brief Measures the counter against steady_clock over about 10 ms.
+     */
+    MYSTIC_NOINLINE static ::mystic::types::uint64_t calibrate() noexcept {
+        using clock = std::chrono::steady_clock;
+        const clock::time_point start = clock::now();
+        const ::mystic::types::uint64_t start_ticks = now();
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+        const clock::time_point end = clock::now();
+        const ::mystic::types::uint64_t end_ticks = now();
+
+        const double seconds = std::chrono::duration<double>(end - start).count();
+        return static_cast<::mystic::types::uint64_t>(
+            static_cast<double>(end_ticks - start_ticks) / seconds);
+    }
+}; // struct cycle_tick_source
+
+/**
+ * @brief Monotonic nanosecond tick source, as of the last scheduler tick.
+ */
+struct coarse_tick_source {
+    /**
+     * @brief Returns the current tick, in nanoseconds.
+     */
+    MYSTIC_FORCEINLINE static ::mystic::types::uint64_t now() noexcept {
+#if (MYSTIC_ARCH_OS == MYSTIC_ARCH_OS_LINUX)
+        struct timespec spec;
+        ::clock_gettime(CLOCK_MONOTONIC_COARSE, &spec);
+        return static_cast<::mystic::types::uint64_t>(spec.tv_sec) * 1000000000u +
+               static_cast<::mystic::types::uint64_t>(spec.tv_nsec);
+#else
+        return static_cast<::mystic::types::uint64_t>(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(
+                std::chrono::steady_clock::now().time_since_epoch())
+                .count());
+#endif
+    }
+
+    /**
+     * @brief Returns the number of ticks per second.
+     */
+    static constexpr ::mystic::types::uint64_t frequency() noexcept { return 1000000000u; }
+}; // struct coarse_tick_source
+
+/**
+ * @brief Converts the ticks of a tick source to a coarser unit.
+ *
+ * @tparam TickSource The tick source, see `cycle_tick_source`.
+ */
+template <typename TickSource>
+class tick_scale {
+public:
+    /**
+     * @brief Constructs a scale whose unit is resolution long.
+     */
+    explicit tick_scale(std::chrono::nanoseconds resolution) noexcept
+        : per_source_tick_(1e9 / (static_cast<double>(TickSource::frequency()) *
+                                  static_cast<double>(resolution.count()))),
+          per_nanosecond_(1.0 / static_cast<double>(resolution.count())) {}
+
+    /**
+     * @brief Returns the current time, in units.
+     */
+    MYSTIC_FORCEINLINE ::mystic::types::uint64_t now() const noexcept {
+        return scale(TickSource::now());
+    }
+
+    /**
+     * @brief Converts source ticks to units, rounding down.
+     */
+    MYSTIC_FORCEINLINE ::mystic::types::uint64_t scale(
+        ::mystic::types::uint64_t source_ticks) const noexcept {
+        return static_cast<::mystic::types::uint64_t>(static_cast<double>(source_ticks) *
+                                                      per_source_tick_);
+    }
+
+    /**
+     * @brief Converts a duration to units, rounding up.
+     */
+    ::mystic::types::uint64_t units(std::chrono::nanoseconds duration) const noexcept {
+        if (duration.count() <= 0) {
+            return 0;
+        }
+        const double exact = static_cast<double>(duration.count()) * per_nanosecond_;
+        const auto whole = static_cast<::mystic::types::uint64_t>(exact);
+        return static_cast<double>(whole) < exact ? whole + 1 : whole;
+    }
+
+private:
+    /// Units per source tick
+    double per_source_tick_;
+
+    /// Units per nanosecond
+    double per_nanosecond_;
+
+}; // class tick_scale
+
+} // namespace time
+} // namespace mystic
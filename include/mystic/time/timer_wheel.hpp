@@ -0,0 +1,424 @@
+/**
+ * Copyright 2025 Suryansh Singh
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *      https://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ * ------------------------------------------------------------------------------------------------------
+ *
+ * @path [ROOT]/include/mystic/time/timer_wheel.hpp
+ * @file timer_wheel.hpp
+ * @brief Defines hierarchical timing wheel.
+ *
+ * @details
+ * This header provides `timer_wheel`, a hierarchical timing wheel for
+ * large numbers of timeouts, which are mostly cancelled before they fire.
+ *
+ * 1. Timers are intrusive nodes (derive from, or embed,
+ *    `timer_wheel::timer`), so scheduling never allocates.
+ * 2. Schedule and cancel are O(1), a timer goes to the level of the
+ *    highest 6-bit digit in which its expiry differs from the current
+ *    tick, and is cascaded one level down each time that digit is reached.
+ * 3. `advance()` jumps straight to the next occupied slot, using a
+ *    64-bit occupancy mask per level, so idle stretches cost nothing, and
+ *    it hands the expired timers to the handler as one batch.
+ *
+ * The wheel counts abstract ticks, the caller picks the granularity, for
+ * instance with `tick_scale` over a cheap tick source. It is not thread
+ * safe, own one per event loop.
+ *
+ * @code{.cpp}
+ * #include "mystic/time/timer_wheel.hpp"
+ *
+ * namespace mt = mystic::time;
+ *
+ * struct Connection : mt::timer_wheel::timer { ... };
+ *
+ * mt::tick_scale<mt::coarse_tick_source> ms(std::chrono::milliseconds(1));
+ * mt::timer_wheel wheel(ms.now());
+ *
+ * wheel.schedule_after(connection, ms.units(std::chrono::seconds(30)));
+ * ...
+ * wheel.advance(ms.now(), [](mt::timer_wheel::timer& expired) {
+ *     static_cast<Connection&>(expired).close();
+ * });
+ * @endcode
+ *
+ * @author thedevmystic (Surya)
+ * @copyright 2025 Suryansh Singh Apache-2.0 License
+ *
+ * SPDX-FileCopyrightText: 2025 Suryansh Singh
+ * SPDX-License-Identifier: Apache-2.0
+ */
+#pragma once
+
+#include <limits>
+
+#include "mystic/attributes/attributes.hpp"
+#include "mystic/time/tick_source.hpp"
+#include "mystic/types/standard_def.hpp"
+#include "mystic/types/standard_int.hpp"
+
+/**
+ * @namespace mystic::time::internal
+ * @brief Internal implementation details of time.
+ *
+ * @details
+ * This namespace contains internal implementation details of time.
+ * **It should not be used directly.**
+ */
+namespace mystic::time::internal {
+
+/**
+ * @brief Node of a circular doubly linked list.
+ */
+struct TimerLink {
+    TimerLink* previous = nullptr;
+    TimerLink* next = nullptr;
+
+    /**
+     * @brief Makes this node an empty list head.
+     */
+    void makeHead() noexcept { previous = next = this; }
+
+    bool isEmptyHead() const noexcept { return next == this; }
+
+    /**
+     * @brief Inserts node before this one (at the tail, if this is a head).
+     */
+    void insertBefore(TimerLink& node) noexcept {
+        node.previous = previous;
+        node.next = this;
+        previous->next = &node;
+        previous = &node;
+    }
+
+    /**
+     * @brief Unlinks this node from its list.
+     */
+    void unlink() noexcept {
+        previous->next = next;
+        next->previous = previous;
+        previous = next = nullptr;
+    }
+}; // struct TimerLink
+
+/**
+ * @brief Returns the index of the highest set bit of a non-zero value.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::uint32_t highestBit(::mystic::types::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63u - static_cast<::mystic::types::uint32_t>(__builtin_clzll(value));
+#else
+    ::mystic::types::uint32_t bit = 0;
+    while ((value >>= 1) != 0) {
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+/**
+ * @brief Returns the index of the lowest set bit of a non-zero value.
+ */
+MYSTIC_FORCEINLINE ::mystic::types::uint32_t lowestBit(::mystic::types::uint64_t value) noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<::mystic::types::uint32_t>(__builtin_ctzll(value));
+#else
+    ::mystic::types::uint32_t bit = 0;
+    while ((value & 1) == 0) {
+        value >>= 1;
+        ++bit;
+    }
+    return bit;
+#endif
+}
+
+} // namespace mystic::time::internal
+
+/**
+ * @namespace mystic
+ * @brief Top-level namespace.
+ */
+namespace mystic {
+
+/**
+ * @namespace mystic::time
+ * @brief Clocks, timers and time formatting.
+ */
+namespace time {
+
+/**
+ * @brief Hierarchical timing wheel of intrusive timers.
+ */
+class timer_wheel {
+public:
+    using tick_type = ::mystic::types::uint64_t;
+
+    /// Returned by next_event() when no timer is scheduled.
+    static constexpr tick_type kNever = std::numeric_limits<tick_type>::max();
+
+    /// Bits of the tick consumed by one level.
+    static constexpr ::mystic::types::uint32_t kSlotBits = 6;
+
+    /// Number of slots in one level.
+    static constexpr ::mystic::types::uint32_t kSlotCount = 1u << kSlotBits;
+
+    /// Number of levels, enough for any 64-bit tick.
+    static constexpr ::mystic::types::uint32_t kLevelCount = (64 + kSlotBits - 1) / kSlotBits;
+
+    /**
+     * @brief Intrusive timer, derive from it or embed it.
+     *
+     * A timer must stay put, and outlive its scheduling (or be cancelled).
+     */
+    class timer : private internal::TimerLink {
+    public:
+        timer() noexcept = default;
+        timer(const timer&) = delete;
+        timer& operator=(const timer&) = delete;
+
+        /**
+         * @brief Returns true if scheduled (or expired but not yet handled).
+         */
+        MYSTIC_NODISCARD bool is_scheduled() const noexcept { return next != nullptr; }
+
+        /**
+         * @brief Returns the tick the timer is scheduled for.
+         */
+        MYSTIC_NODISCARD tick_type expiry() const noexcept { return expiry_; }
+
+    private:
+        friend class timer_wheel;
+
+        /// Scheduled tick
+        tick_type expiry_ = 0;
+
+    }; // class timer
+
+    /**
+     * @brief Constructs an empty wheel whose current tick is now.
+     */
+    explicit timer_wheel(tick_type now = 0) noexcept : now_(now) {
+        for (Level& level : levels_) {
+            for (internal::TimerLink& slot : level.slots) {
+                slot.makeHead();
+            }
+        }
+    }
+
+    timer_wheel(const timer_wheel&) = delete;
+    timer_wheel& operator=(const timer_wheel&) = delete;
+
+    /**
+     * @brief Returns the current tick.
+     */
+    MYSTIC_NODISCARD tick_type now() const noexcept { return now_; }
+
+    /**
+     * @brief Returns the number of scheduled timers.
+     */
+    MYSTIC_NODISCARD ::mystic::types::size_t size() const noexcept { return size_; }
+
+    MYSTIC_NODISCARD bool empty() const noexcept { return size_ == 0; }
+
+    /**
+     * @brief Schedules t for tick expiry, rescheduling it if it is already
+     * scheduled. An expiry not after now() fires at tick now() + 1.
+     */
+    void schedule(timer& t, tick_type expiry) noexcept {
+        if (t.is_scheduled()) {
+            cancel(t);
+        }
+        t.expiry_ = expiry;
+        place(t, now_);
+        ++size_;
+    }
+
+    /**
+     * @brief Schedules t for delay ticks after now().
+     */
+    void schedule_after(timer& t, tick_type delay) noexcept {
+        schedule(t, delay < kNever - now_ ? now_ + delay : kNever);
+    }
+
+    /**
+     * @brief Cancels t, if scheduled.
+     *
+     * @returns True if t was scheduled.
+     */
+    bool cancel(timer& t) noexcept {
+        if (!t.is_scheduled()) {
+            return false;
+        }
+        // An emptied slot keeps its occupancy bit until next_event() sees it.
+        t.unlink();
+        --size_;
+        return true;
+    }
+
+    /**
+     * @brief Returns a lower bound of the next expiry (the next tick at
+     * which advance() has work to do), or kNever if no timer is scheduled.
+     */
+    MYSTIC_NODISCARD tick_type next_event() noexcept {
+        if (size_ == 0) {
+            return kNever;
+        }
+        tick_type best = kNever;
+        for (::mystic::types::uint32_t index = 0; index < kLevelCount; ++index) {
+            Level& level = levels_[index];
+            while (level.occupied != 0) {
+                const ::mystic::types::uint32_t slot = internal::lowestBit(level.occupied);
+                if (level.slots[slot].isEmptyHead()) {
+                    level.occupied &= level.occupied - 1;
+                    continue;
+                }
+                const ::mystic::types::uint32_t shift = index * kSlotBits;
+                const tick_type tick =
+                    (upperBits(now_, index) | (static_cast<tick_type>(slot) << shift));
+                if (tick < best) {
+                    best = tick;
+                }
+                break;
+            }
+        }
+        return best;
+    }
+
+    /**
+     * @brief Moves the current tick to now, and passes every timer whose
+     * expiry is not after now to on_expired(timer&).
+     *
+     * Timers are handed over in batches, one per occupied tick, after the
+     * wheel is updated, so on_expired may schedule or cancel any timer.
+     *
+     * @returns The number of expired timers.
+     */
+    template <typename Handler>
+    ::mystic::types::size_t advance(tick_type now, Handler&& on_expired) {
+        ::mystic::types::size_t fired = 0;
+        internal::TimerLink batch;
+        batch.makeHead();
+
+        while (size_ != 0) {
+            const tick_type tick = next_event();
+            if (tick > now) {
+                break;
+            }
+            now_ = tick;
+            collect(tick, batch);
+
+            while (!batch.isEmptyHead()) {
+                timer& expired = static_cast<timer&>(*batch.next);
+                expired.unlink();
+                --size_;
+                ++fired;
+                on_expired(expired);
+            }
+
+            // No tick follows kNever, so the wheel cannot move past it.
+            if (tick == kNever) {
+                break;
+            }
+        }
+
+        if (now > now_) {
+            now_ = now;
+        }
+        return fired;
+    }
+
+private:
+    /**
+     * @brief One level of the wheel.
+     */
+    struct Level {
+        /// Bit i is set if slots[i] may be non-empty
+        ::mystic::types::uint64_t occupied = 0;
+
+        internal::TimerLink slots[kSlotCount];
+    }; // struct Level
+
+    /**
+     * @brief Returns tick with the digits of level index and below cleared.
+     */
+    static tick_type upperBits(tick_type tick, ::mystic::types::uint32_t index) noexcept {
+        const ::mystic::types::uint32_t shift = (index + 1) * kSlotBits;
+        return shift >= 64 ? 0 : (tick >> shift) << shift;
+    }
+
+    /**
+     * @brief Links t into the slot matching its expiry, relative to the
+     * last processed tick (reference).
+     */
+    void place(timer& t, tick_type reference) noexcept {
+        const tick_type expiry = t.expiry_ > reference ? t.expiry_ : reference + 1;
+        const ::mystic::types::uint32_t index =
+            internal::highestBit(expiry ^ reference) / kSlotBits;
+        const ::mystic::types::uint32_t slot =
+            static_cast<::mystic::types::uint32_t>(expiry >> (index * kSlotBits)) &
+            (kSlotCount - 1);
+        levels_[index].slots[slot].insertBefore(t);
+        levels_[index].occupied |= ::mystic::types::uint64_t{1} << slot;
+    }
+
+    /**
+     * @brief Cascades the slots reached at tick, and moves the timers
+     * expiring at tick to batch.
+     */
+    void collect(tick_type tick, internal::TimerLink& batch) noexcept {
+        for (::mystic::types::uint32_t index = kLevelCount - 1; index > 0; --index) {
+            const ::mystic::types::uint32_t shift = index * kSlotBits;
+            if ((tick & ((tick_type{1} << shift) - 1)) != 0) {
+                continue;
+            }
+            const ::mystic::types::uint32_t slot =
+                static_cast<::mystic::types::uint32_t>(tick >> shift) & (kSlotCount - 1);
+            cascade(levels_[index], slot, tick, batch);
+        }
+        cascade(levels_[0], static_cast<::mystic::types::uint32_t>(tick) & (kSlotCount - 1), tick,
+                batch);
+    }
+
+    /**
+     * @brief Re-places every timer of a slot relative to tick, moving those
+     * expiring at tick to batch.
+     */
+    void cascade(Level& level, ::mystic::types::uint32_t slot, tick_type tick,
+                 internal::TimerLink& batch) noexcept {
+        level.occupied &= ~(::mystic::types::uint64_t{1} << slot);
+        internal::TimerLink& head = level.slots[slot];
+        while (!head.isEmptyHead()) {
+            timer& t = static_cast<timer&>(*head.next);
+            t.unlink();
+            if (t.expiry_ <= tick) {
+                batch.insertBefore(t);
+            } else {
+                place(t, tick);
+            }
+        }
+    }
+
+    /// Last processed tick
+    tick_type now_;
+
+    /// Number of scheduled timers
+    ::mystic::types::size_t size_ = 0;
+
+    /// Levels, level i holds timers whose expiry first differs from the
+    /// current tick in digit i
+    Level levels_[kLevelCount];
+
+}; // class timer_wheel
+
+} // namespace time
+} // namespace mystic